@@ -0,0 +1,274 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "analyzer.h"
+#include "topology.h"
+
+#define CORPUS_BATCH_SIZE 256
+#define CORPUS_LINE_LENGTH 64
+
+typedef struct {
+    CorpusParameters *parameters;   /* Shared description of the corpus */
+    FILE *output;                   /* CSV destination */
+    pthread_mutex_t lock;           /* Guards next_seed_index, output and failed */
+    int next_seed_index;            /* Index of the first seed not yet taken by a worker */
+    bool failed;                    /* Records if any worker could not do its work */
+} Corpus;
+
+/**
+ * Find representative of the zero region which contains the Tile.
+ * Halves the path on the way up to keep later lookups short.
+ */
+static int find_region(int *parents, int index) {
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+    return index;
+}
+
+/**
+ * Join two zero regions.
+ * @return true if the regions were different before, false otherwise
+ */
+static bool join_regions(int *parents, int first, int second) {
+    int first_root = find_region(parents, first);
+    int second_root = find_region(parents, second);
+    if (first_root == second_root) {
+        return false;
+    }
+    parents[second_root] = first_root;
+    return true;
+}
+
+/**
+ * Metrics of RECTANGLE board. Every zero tile is joined only with zero tiles visited
+ * before it (left, upper left, upper and upper right), which covers every adjacent pair once.
+ */
+static BoardMetrics analyze_rectangle_board(Board *board) {
+    // region parent of every zero tile, indexed by row * column_count + column
+    int parents[MAX_ROW_COUNT * MAX_COLUMN_COUNT];
+    BoardMetrics metrics = {0, 0, 0};
+
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            int value = board->tiles[row][column]->value;
+            if (value < 0) {
+                continue;
+            }
+
+            if (value == 0) {
+                int index = row * board->column_count + column;
+                parents[index] = index;
+                metrics.opening_count++;
+
+                int previous[4][2] = {{0, -1}, {-1, -1}, {-1, 0}, {-1, 1}};
+                for (int p = 0; p < 4; p++) {
+                    int neighbour_row = row + previous[p][0];
+                    int neighbour_column = column + previous[p][1];
+                    if (is_input_data_correct(board, neighbour_row, neighbour_column)
+                        && board->tiles[neighbour_row][neighbour_column]->value == 0
+                        && join_regions(parents, neighbour_row * board->column_count + neighbour_column, index)) {
+                        metrics.opening_count--;
+                    }
+                }
+                continue;
+            }
+
+            bool touches_zero = false;
+            for (int drow = -1; drow <= 1 && !touches_zero; drow++) {
+                for (int dcolumn = -1; dcolumn <= 1; dcolumn++) {
+                    if (is_input_data_correct(board, row + drow, column + dcolumn)
+                        && board->tiles[row + drow][column + dcolumn]->value == 0) {
+                        touches_zero = true;
+                        break;
+                    }
+                }
+            }
+            if (!touches_zero) {
+                metrics.isolated_number_count++;
+            }
+        }
+    }
+
+    metrics.three_bv = metrics.opening_count + metrics.isolated_number_count;
+    return metrics;
+}
+
+/*
+ * Defines analyze_board for a topology whose neighbours are not limited to the rows
+ * visited before, so zero tiles are joined with all their zero neighbours.
+ */
+#define DEFINE_ANALYZE_BOARD(name, neighbours_function)                                         \
+    static BoardMetrics name(Board *board) {                                                    \
+        /* region parent of every tile, only zero tiles are joined */                           \
+        int parents[MAX_ROW_COUNT * MAX_COLUMN_COUNT];                                          \
+        for (int index = 0; index < board->row_count * board->column_count; index++) {          \
+            parents[index] = index;                                                             \
+        }                                                                                       \
+        TilePosition neighbours[MAX_NEIGHBOUR_COUNT];                                           \
+        BoardMetrics metrics = {0, 0, 0};                                                       \
+                                                                                                \
+        for (int row = 0; row < board->row_count; row++) {                                      \
+            for (int column = 0; column < board->column_count; column++) {                      \
+                int value = board->tiles[row][column]->value;                                   \
+                if (value < 0) {                                                                \
+                    continue;                                                                   \
+                }                                                                               \
+                int index = row * board->column_count + column;                                 \
+                bool touches_zero = false;                                                      \
+                if (value == 0) {                                                               \
+                    metrics.opening_count++;                                                    \
+                }                                                                               \
+                int neighbour_count = neighbours_function(board, row, column, neighbours);      \
+                for (int n = 0; n < neighbour_count; n++) {                                     \
+                    if (board->tiles[neighbours[n].row][neighbours[n].column]->value != 0) {    \
+                        continue;                                                               \
+                    }                                                                           \
+                    touches_zero = true;                                                        \
+                    /* every joined pair of zero regions means one opening less */              \
+                    int neighbour_index = neighbours[n].row * board->column_count + neighbours[n].column; \
+                    if (value == 0 && join_regions(parents, neighbour_index, index)) {          \
+                        metrics.opening_count--;                                                \
+                    }                                                                           \
+                }                                                                               \
+                if (value > 0 && !touches_zero) {                                               \
+                    metrics.isolated_number_count++;                                            \
+                }                                                                               \
+            }                                                                                   \
+        }                                                                                       \
+                                                                                                \
+        metrics.three_bv = metrics.opening_count + metrics.isolated_number_count;               \
+        return metrics;                                                                         \
+    }
+
+DEFINE_ANALYZE_BOARD(analyze_torus_board, torus_neighbours)
+DEFINE_ANALYZE_BOARD(analyze_hexagon_board, hexagon_neighbours)
+
+/**
+ * Compute difficulty metrics of the Board in one pass over the tiles.
+ * Tile values must be already set by set_tile_values.
+ * @return 3BV, openings count and isolated numbers count of the Board
+ */
+BoardMetrics analyze_board(Board *board) {
+    assert(board != NULL);
+
+    switch (board->topology) {
+        case TORUS:
+            return analyze_torus_board(board);
+        case HEXAGON:
+            return analyze_hexagon_board(board);
+        default:
+            return analyze_rectangle_board(board);
+    }
+}
+
+/**
+ * Take the next batch of seeds.
+ * @return number of seeds in the batch, 0 if the corpus is done
+ */
+static int take_seed_batch(Corpus *corpus, int *first_index) {
+    pthread_mutex_lock(&corpus->lock);
+    int remaining = corpus->parameters->seed_count - corpus->next_seed_index;
+    int taken = remaining < CORPUS_BATCH_SIZE ? remaining : CORPUS_BATCH_SIZE;
+    if (corpus->failed) {
+        taken = 0;
+    }
+    *first_index = corpus->next_seed_index;
+    corpus->next_seed_index += taken;
+    pthread_mutex_unlock(&corpus->lock);
+    return taken;
+}
+
+/**
+ * Worker of analyze_corpus. One Board is reused for all seeds of the worker,
+ * mines of the previous seed are taken off through the mine index.
+ */
+static void *analyze_corpus_worker(void *argument) {
+    Corpus *corpus = (Corpus *) argument;
+    CorpusParameters *parameters = corpus->parameters;
+    char lines[CORPUS_BATCH_SIZE * CORPUS_LINE_LENGTH];
+
+    Board *board = create_board(parameters->row_count, parameters->column_count, parameters->mine_count);
+    if (board == NULL) {
+        pthread_mutex_lock(&corpus->lock);
+        corpus->failed = true;
+        pthread_mutex_unlock(&corpus->lock);
+        return NULL;
+    }
+
+    int first_index;
+    int taken;
+    while ((taken = take_seed_batch(corpus, &first_index)) > 0) {
+        int length = 0;
+        for (int index = first_index; index < first_index + taken; index++) {
+            unsigned int seed = parameters->first_seed + (unsigned int) index;
+            while (board->placed_mine_count > 0) {
+                remove_mine(board, board->mines[0].row, board->mines[0].column);
+            }
+            // corpus boards have no first click, so no tile is kept free of mines
+            set_mines_with_seed(board, seed, -1, -1);
+            set_tile_values(board);
+
+            BoardMetrics metrics = analyze_board(board);
+            length += snprintf(lines + length, CORPUS_LINE_LENGTH, "%u,%d,%d,%d\n", seed,
+                               metrics.three_bv, metrics.opening_count, metrics.isolated_number_count);
+        }
+
+        pthread_mutex_lock(&corpus->lock);
+        if (fwrite(lines, 1, length, corpus->output) != (size_t) length) {
+            corpus->failed = true;
+        }
+        pthread_mutex_unlock(&corpus->lock);
+    }
+
+    destroy_board(board);
+    return NULL;
+}
+
+/**
+ * Generate Boards for consecutive seeds and write their metrics to output as CSV.
+ * Lines are written as soon as a batch is done, so their order follows the workers, not the seeds.
+ * @return true if all metrics were written, false if parameters are invalid or any worker failed
+ */
+bool analyze_corpus(CorpusParameters *parameters, FILE *output) {
+    assert(parameters != NULL);
+    assert(output != NULL);
+
+    if (parameters->seed_count < 0 || parameters->thread_count <= 0) {
+        return false;
+    }
+    // same limits as create_board, checked here so no worker has to fail on them
+    Board *probe = create_board(parameters->row_count, parameters->column_count, parameters->mine_count);
+    if (probe == NULL) {
+        return false;
+    }
+    destroy_board(probe);
+
+    fprintf(output, "seed,three_bv,opening_count,isolated_number_count\n");
+
+    Corpus corpus = {parameters, output, PTHREAD_MUTEX_INITIALIZER, 0, false};
+    pthread_t *threads = (pthread_t *) calloc(parameters->thread_count, sizeof(pthread_t));
+    if (threads == NULL) {
+        return false;
+    }
+
+    int started = 0;
+    while (started < parameters->thread_count) {
+        if (pthread_create(&threads[started], NULL, analyze_corpus_worker, &corpus) != 0) {
+            pthread_mutex_lock(&corpus.lock);
+            corpus.failed = true;
+            pthread_mutex_unlock(&corpus.lock);
+            break;
+        }
+        started++;
+    }
+    for (int thread = 0; thread < started; thread++) {
+        pthread_join(threads[thread], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&corpus.lock);
+
+    return !corpus.failed && fflush(output) == 0;
+}
@@ -0,0 +1,24 @@
+#ifndef MINES_ANALYZER_H
+#define MINES_ANALYZER_H
+#include <stdio.h>
+#include "board.h"
+
+typedef struct {
+    int three_bv;                /* Minimum number of clicks needed to clear the Board */
+    int opening_count;           /* Number of connected regions of zero tiles */
+    int isolated_number_count;   /* Number tiles which do not touch any zero tile */
+} BoardMetrics;
+
+typedef struct {
+    int row_count;               /* Number of rows of every generated Board */
+    int column_count;            /* Number of columns of every generated Board */
+    int mine_count;              /* Number of mines of every generated Board */
+    unsigned int first_seed;     /* Seed of the first generated Board */
+    int seed_count;              /* Number of consecutive seeds to analyze */
+    int thread_count;            /* Number of worker threads */
+} CorpusParameters;
+
+BoardMetrics analyze_board(Board *board);
+bool analyze_corpus(CorpusParameters *parameters, FILE *output);
+
+#endif //MINES_ANALYZER_H
@@ -0,0 +1,82 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "board.h"
+#include "spectator.h"
+
+#define DEFAULT_VIEWER_COUNT 1000
+#define DEFAULT_KEYFRAME_INTERVAL 32
+
+/*
+ * Local fan-out of one played game to many viewers.
+ * Usage: bench_spectator [viewer_count] [keyframe_interval] [seed]
+ * Prints bandwidth per viewer and encode cost per move.
+ */
+
+static void receive_frame(SpectatorFrame *frame, void *context) {
+    unsigned long long *received_bytes = (unsigned long long *) context;
+    *received_bytes += frame->size;
+}
+
+static unsigned long long get_nanoseconds() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long) time.tv_sec * 1000000000ULL + (unsigned long long) time.tv_nsec;
+}
+
+int main(int argc, char *argv[]) {
+    int viewer_count = argc > 1 ? atoi(argv[1]) : DEFAULT_VIEWER_COUNT;
+    int keyframe_interval = argc > 2 ? atoi(argv[2]) : DEFAULT_KEYFRAME_INTERVAL;
+    unsigned int seed = argc > 3 ? (unsigned int) strtoul(argv[3], NULL, 10) : 11;
+    if (viewer_count <= 0 || keyframe_interval <= 0) {
+        fprintf(stderr, "Viewer count and keyframe interval must be greater than zero\n");
+        return EXIT_FAILURE;
+    }
+
+    Board *board = create_board(MAX_ROW_COUNT, MAX_COLUMN_COUNT, MAX_ROW_COUNT * MAX_COLUMN_COUNT / 6);
+    SpectatorChannel *channel = board == NULL ? NULL : create_spectator_channel(board, keyframe_interval);
+    unsigned long long *received_bytes = (unsigned long long *) calloc(viewer_count, sizeof(unsigned long long));
+    if (channel == NULL || received_bytes == NULL) {
+        fprintf(stderr, "Failed to create spectator channel\n");
+        return EXIT_FAILURE;
+    }
+    set_mines_with_seed(board, seed, 0, 0);
+    set_tile_values(board);
+    for (int viewer = 0; viewer < viewer_count; viewer++) {
+        subscribe_spectator(channel, receive_frame, &received_bytes[viewer]);
+    }
+
+    // every closed tile without a mine is one move, row by row
+    int move_count = 0;
+    unsigned long long publish_nanoseconds = 0;
+    unsigned long long start = get_nanoseconds();
+    publish_move(channel);
+    publish_nanoseconds += get_nanoseconds() - start;
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            if (!board->tiles[row][column]->is_mine && open_tile(board, row, column) > 0) {
+                start = get_nanoseconds();
+                publish_move(channel);
+                publish_nanoseconds += get_nanoseconds() - start;
+                move_count++;
+            }
+        }
+    }
+
+    SpectatorStats stats = get_spectator_stats(channel);
+    unsigned long long keyframe_size = KEYFRAME_HEADER_SIZE + (board->row_count * board->column_count + 1) / 2;
+    printf("board:                 %dx%d, %d mines\n", board->row_count, board->column_count, board->mine_count);
+    printf("viewers:               %d\n", viewer_count);
+    printf("moves:                 %d\n", move_count);
+    printf("frames:                %llu (%llu keyframes)\n", stats.frame_count, stats.keyframe_count);
+    printf("bandwidth per viewer:  %llu bytes, %.1f bytes per move (keyframes only: %llu bytes)\n",
+           received_bytes[0], (double) received_bytes[0] / stats.frame_count, stats.frame_count * keyframe_size);
+    printf("encode cost per move:  %.2f us\n", stats.encode_nanoseconds / 1000.0 / stats.frame_count);
+    printf("publish cost per move: %.2f us including fan-out\n", publish_nanoseconds / 1000.0 / stats.frame_count);
+
+    free(received_bytes);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    return EXIT_SUCCESS;
+}
@@ -1,8 +1,10 @@
 #ifndef MINES_BOARD_H
 #define MINES_BOARD_H
 #include <stdbool.h>
+#include <stdint.h>
 #define MAX_ROW_COUNT 30
 #define MAX_COLUMN_COUNT 30
+#define VISIBLE_STATE_COUNT 12
 
 typedef enum {
     CLOSED,
@@ -10,28 +12,52 @@ typedef enum {
     MARKED
 } TileState;
 
+typedef enum {
+    RECTANGLE,
+    TORUS,
+    HEXAGON
+} Topology;
+
 typedef struct {
-    bool is_mine;                /* Records if mine is on the Tile */
+    bool is_mine;                /* Records if mine is on the Tile, changed only by place_mine and remove_mine */
     TileState tile_state;        /* Enum for status of the Tile state */
     int value;                   /* Number of neighbour tiles with mines,
                                     or -1 if the tile contains a mine */
 } Tile;
 
+typedef struct {
+    int row;                     /* Row of the Tile */
+    int column;                  /* Column of the Tile */
+} TilePosition;
+
 typedef struct {
     int row_count;                                  /* Number of rows in the Board */
     int column_count;                               /* Number of columns in the Board */
     int mine_count;                                 /* Number of mines in the Board */
+    Topology topology;                              /* Which tiles are neighbours, RECTANGLE by default */
     Tile *tiles[MAX_ROW_COUNT][MAX_COLUMN_COUNT];   /* 2-dimensional struct array of the tiles */
+    TilePosition mines[MAX_ROW_COUNT * MAX_COLUMN_COUNT]; /* Coordinates of every placed mine, kept by place_mine and remove_mine */
+    int placed_mine_count;                          /* Number of valid entries in mines */
+    uint64_t hash;                                  /* Zobrist hash of the visible state of the tiles */
 } Board;
 
 Board *create_board(int row_count, int column_count, int mine_count);
 Board *create_interactive_board();
 bool input_board_parameters(int* row_count, int* col_count, int* mine_count);
 void destroy_board(Board *board);
+bool set_board_topology(Board *board, Topology topology);
+int open_tile(Board *board, int row, int column);
 bool is_game_solved(Board *board);
 bool is_input_data_correct(Board *board, int input_row, int input_column);
 void open_all_mines(Board *board);
 void set_mines_randomly(Board *board, int input_row, int input_column);
+void set_mines_with_seed(Board *board, unsigned int seed, int first_click_row, int first_click_column);
+void place_mine(Board *board, int row, int column);
+void remove_mine(Board *board, int row, int column);
+bool is_mine_index_correct(Board *board);
+void set_tile_state(Board *board, int row, int column, TileState tile_state);
+uint64_t compute_board_hash(Board *board);
+int get_visible_tile_state(Tile *tile);
 //DECLARATION FOR AVOIDING WARNINGS//
 void set_tile_values(Board *board);
 bool is_mine_on(Board *board, int row, int column);
@@ -0,0 +1,486 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "input.h"
+#include "topology.h"
+
+#define ESCAPE 27
+#define RESTORING_SIGNAL_COUNT 3
+
+static InputReader standard_reader;
+static bool is_standard_reader_open = false;
+
+// signals which end or stop the process, the terminal is restored before they take effect
+static const int restoring_signals[RESTORING_SIGNAL_COUNT] = {SIGINT, SIGTERM, SIGTSTP};
+static struct sigaction original_actions[RESTORING_SIGNAL_COUNT];
+static bool is_handler_installed[RESTORING_SIGNAL_COUNT];
+static InputReader *volatile raw_reader = NULL;
+
+/**
+ * Terminal mode without line editing and echo.
+ * Signals stay enabled, so Ctrl+C still ends the game and Ctrl+Z stops it.
+ * @return raw variant of the original mode
+ */
+static struct termios get_raw_mode(const struct termios *original_mode) {
+    struct termios raw_mode = *original_mode;
+    raw_mode.c_lflag &= ~(ICANON | ECHO);
+    raw_mode.c_cc[VMIN] = 1;
+    raw_mode.c_cc[VTIME] = 0;
+    return raw_mode;
+}
+
+/**
+ * Restore the terminal mode of the raw reader, then let the signal take its original action.
+ * If the process goes on, e.g. it is continued after Ctrl+Z, the terminal is switched to raw mode again.
+ */
+static void restore_terminal_on_signal(int signal_number) {
+    int saved_errno = errno;
+    int index = 0;
+    while (index < RESTORING_SIGNAL_COUNT && restoring_signals[index] != signal_number) {
+        index++;
+    }
+    InputReader *reader = raw_reader;
+    if (index == RESTORING_SIGNAL_COUNT || reader == NULL) {
+        errno = saved_errno;
+        return;
+    }
+
+    struct sigaction own_action;
+    sigaction(signal_number, &original_actions[index], &own_action);
+    tcsetattr(reader->fd, TCSANOW, &reader->original_mode);
+
+    // the signal is blocked during its handler, so it is unblocked to take the original action now
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, signal_number);
+    sigprocmask(SIG_UNBLOCK, &signals, NULL);
+    raise(signal_number);
+
+    struct termios raw_mode = get_raw_mode(&reader->original_mode);
+    tcsetattr(reader->fd, TCSANOW, &raw_mode);
+    sigaction(signal_number, &own_action, NULL);
+    errno = saved_errno;
+}
+
+/**
+ * Restore the terminal of the reader when the process is ended or stopped by a signal.
+ * Only one reader at a time has the handlers, the terminal is the same for all of them.
+ */
+static void install_signal_handlers(InputReader *reader) {
+    if (raw_reader != NULL) {
+        return;
+    }
+    raw_reader = reader;
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = restore_terminal_on_signal;
+    sigemptyset(&action.sa_mask);
+    for (int index = 0; index < RESTORING_SIGNAL_COUNT; index++) {
+        sigaction(restoring_signals[index], NULL, &original_actions[index]);
+        // ignored signals stay ignored, e.g. SIGINT of a background job
+        is_handler_installed[index] = original_actions[index].sa_handler != SIG_IGN;
+        if (is_handler_installed[index]) {
+            sigaction(restoring_signals[index], &action, NULL);
+        }
+    }
+}
+
+/**
+ * Give the signals their original actions back, if the reader installed the handlers.
+ */
+static void remove_signal_handlers(InputReader *reader) {
+    if (raw_reader != reader) {
+        return;
+    }
+    for (int index = 0; index < RESTORING_SIGNAL_COUNT; index++) {
+        if (is_handler_installed[index]) {
+            sigaction(restoring_signals[index], &original_actions[index], NULL);
+            is_handler_installed[index] = false;
+        }
+    }
+    raw_reader = NULL;
+}
+
+/**
+ * Switch the terminal to raw mode, if fd is a terminal.
+ * Keys are then delivered one by one without echo and without waiting for Enter.
+ * The terminal mode is restored if the process is ended or stopped by a signal,
+ * so the reader must stay at its address until it is closed.
+ * @return true if the reader is ready, false if fd is invalid
+ */
+bool open_input_reader(InputReader *reader, int fd) {
+    assert(reader != NULL);
+    memset(reader, 0, sizeof(InputReader));
+    if (fd < 0) {
+        return false;
+    }
+    reader->fd = fd;
+
+    if (isatty(fd) && tcgetattr(fd, &reader->original_mode) == 0) {
+        struct termios raw_mode = get_raw_mode(&reader->original_mode);
+        reader->is_raw = tcsetattr(fd, TCSANOW, &raw_mode) == 0;
+    }
+    if (reader->is_raw) {
+        install_signal_handlers(reader);
+    }
+    return true;
+}
+
+/**
+ * Open reader of the stream. A terminal is switched to raw mode and read directly.
+ * Other input is read through stdio, so the reader and scanf on the same stream
+ * share its buffer and none of them loses what the other has read ahead.
+ * @return true if the reader is ready, false if the stream has no file descriptor
+ */
+bool open_stream_reader(InputReader *reader, FILE *stream) {
+    assert(reader != NULL);
+    assert(stream != NULL);
+    if (!open_input_reader(reader, fileno(stream))) {
+        return false;
+    }
+    reader->stream = stream;
+    return true;
+}
+
+/**
+ * Restore the terminal mode from before open_input_reader.
+ */
+void close_input_reader(InputReader *reader) {
+    assert(reader != NULL);
+    if (reader->is_raw) {
+        remove_signal_handlers(reader);
+        tcsetattr(reader->fd, TCSANOW, &reader->original_mode);
+        reader->is_raw = false;
+    }
+    reader->start = 0;
+    reader->length = 0;
+}
+
+/**
+ * Close the reader of stdin and restore the terminal for code which reads stdin through stdio.
+ * The next get_standard_input_reader opens it again.
+ */
+void close_standard_input_reader() {
+    if (is_standard_reader_open) {
+        close_input_reader(&standard_reader);
+        is_standard_reader_open = false;
+    }
+}
+
+/**
+ * Reader of stdin shared by the board parameters prompt and the play loop.
+ * It is opened again if stdin was replaced, and the terminal is restored at exit.
+ * @return pointer of the reader
+ */
+InputReader *get_standard_input_reader() {
+    static bool is_exit_handler_set = false;
+
+    if (is_standard_reader_open && standard_reader.stream != stdin) {
+        close_standard_input_reader();
+    }
+    if (!is_standard_reader_open) {
+        is_standard_reader_open = open_stream_reader(&standard_reader, stdin);
+        if (!is_exit_handler_set) {
+            atexit(close_standard_input_reader);
+            is_exit_handler_set = true;
+        }
+    }
+    return &standard_reader;
+}
+
+/**
+ * Make at least count bytes available in the buffer.
+ * Input is read one byte at a time, so nothing is taken from it ahead of the parser.
+ * A stream which is not a raw terminal is a file or a pipe, it is read through stdio
+ * and not waited for by timeout, because poll does not see bytes buffered by stdio.
+ * @param timeout milliseconds to wait for each read, -1 waits forever
+ * @return 1 if the bytes are available, 0 on timeout, -1 if input is closed
+ */
+static int ensure_bytes(InputReader *reader, int count, int timeout) {
+    while (reader->length < count) {
+        if (reader->start > 0) {
+            memmove(reader->buffer, reader->buffer + reader->start, reader->length);
+            reader->start = 0;
+        }
+
+        if (reader->stream != NULL && !reader->is_raw) {
+            int character = getc(reader->stream);
+            if (character == EOF && ferror(reader->stream) && errno == EINTR) {
+                clearerr(reader->stream);
+                return 0;
+            }
+            if (character == EOF) {
+                return -1;
+            }
+            reader->buffer[reader->length] = (char) character;
+            reader->length++;
+            continue;
+        }
+
+        struct pollfd descriptor = {reader->fd, POLLIN, 0};
+        int ready = poll(&descriptor, 1, timeout);
+        if (ready < 0 && errno == EINTR) {
+            return 0;
+        }
+        if (ready < 0) {
+            return -1;
+        }
+        if (ready == 0) {
+            return 0;
+        }
+
+        ssize_t read_count = read(reader->fd, reader->buffer + reader->length, 1);
+        if (read_count < 0 && (errno == EINTR || errno == EAGAIN)) {
+            return 0;
+        }
+        if (read_count <= 0) {
+            return -1;
+        }
+        reader->length += (int) read_count;
+    }
+    return 1;
+}
+
+/**
+ * Take count parsed bytes out of the buffer.
+ */
+static void consume_bytes(InputReader *reader, int count) {
+    reader->start += count;
+    reader->length -= count;
+    if (reader->length == 0) {
+        reader->start = 0;
+    }
+}
+
+/**
+ * Meaning of a single character key.
+ */
+static InputKey get_character_key(char character) {
+    switch (character) {
+        case 'w': case 'k':
+            return KEY_UP;
+        case 's': case 'j':
+            return KEY_DOWN;
+        case 'a': case 'h':
+            return KEY_LEFT;
+        case 'd': case 'l':
+            return KEY_RIGHT;
+        case ' ':
+            return KEY_OPEN;
+        case 'f': case 'm':
+            return KEY_MARK;
+        case 'q':
+            return KEY_QUIT;
+        case '-':
+            return KEY_MINUS;
+        case '\n': case '\r':
+            return KEY_ENTER;
+        case 127: case '\b':
+            return KEY_BACKSPACE;
+        default:
+            return character >= '0' && character <= '9' ? KEY_DIGIT : KEY_OTHER;
+    }
+}
+
+/**
+ * Length of the escape sequence at the start of the buffer. The rest of a sequence
+ * is sent together with Escape, so it is not waited for.
+ * CSI is Escape, '[', parameter and intermediate bytes, and a final byte from 0x40 to 0x7E.
+ * SS3 is Escape, 'O' and one byte.
+ * @return length of a complete CSI or SS3 sequence, 1 for a lone Escape
+ */
+static int get_escape_sequence_length(InputReader *reader) {
+    if (ensure_bytes(reader, 2, 0) != 1) {
+        return 1;
+    }
+    char introducer = reader->buffer[reader->start + 1];
+    if (introducer == 'O') {
+        return ensure_bytes(reader, 3, 0) == 1 ? 3 : 1;
+    }
+    if (introducer != '[') {
+        return 1;
+    }
+    for (int length = 3; length <= INPUT_BUFFER_SIZE; length++) {
+        if (ensure_bytes(reader, length, 0) != 1) {
+            return 1;
+        }
+        unsigned char byte = (unsigned char) reader->buffer[reader->start + length - 1];
+        if (byte >= 0x40 && byte <= 0x7e) {
+            return length;
+        }
+        if (byte < 0x20 || byte > 0x3f) {
+            return 1;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Read next key. Arrow keys arrive as escape sequences and are decoded here,
+ * other sequences like Delete or F1 are KEY_OTHER and a lone Escape means quit.
+ * @param timeout milliseconds to wait for a key, 0 does not wait, -1 waits forever
+ * @return true if event is filled, false if no key arrived before the timeout
+ */
+bool read_input_event(InputReader *reader, int timeout, InputEvent *event) {
+    assert(reader != NULL);
+    assert(event != NULL);
+
+    int status = ensure_bytes(reader, 1, timeout);
+    if (status == 0) {
+        event->key = KEY_NONE;
+        event->character = 0;
+        return false;
+    }
+    if (status < 0) {
+        event->key = KEY_END;
+        event->character = 0;
+        return true;
+    }
+
+    char character = reader->buffer[reader->start];
+    if (character == ESCAPE) {
+        int length = get_escape_sequence_length(reader);
+        char final = reader->buffer[reader->start + length - 1];
+        consume_bytes(reader, length);
+        // arrows are sent as CSI or, in application mode, as SS3
+        InputKey arrows[] = {KEY_UP, KEY_DOWN, KEY_RIGHT, KEY_LEFT};
+        if (length == 1) {
+            event->key = KEY_QUIT;
+        } else if (length == 3 && final >= 'A' && final <= 'D') {
+            event->key = arrows[final - 'A'];
+        } else {
+            event->key = KEY_OTHER;
+        }
+        event->character = 0;
+        return true;
+    }
+
+    consume_bytes(reader, 1);
+    event->key = get_character_key(character);
+    event->character = character;
+    return true;
+}
+
+/**
+ * Show typed text, because the terminal does not echo in raw mode.
+ */
+static void echo(InputReader *reader, const char *text) {
+    if (reader->is_raw) {
+        fflush(stdout);
+        ssize_t written = write(STDOUT_FILENO, text, strlen(text));
+        (void) written;
+    }
+}
+
+/**
+ * Read a whole number terminated by Enter, space or end of input.
+ * Typed characters can be erased by Backspace, the number is checked only when it is terminated.
+ * Malformed number is consumed up to its terminator, so nothing is left in the input.
+ * Number which does not fit into int is malformed too.
+ * @return true if a valid number was read, false otherwise
+ */
+bool read_number(InputReader *reader, int *value) {
+    assert(reader != NULL);
+    assert(value != NULL);
+
+    // one place more than the longest number, so too long input is recognised
+    char typed[MAX_NUMBER_LENGTH + 3];
+    int typed_count = 0;
+    fflush(stdout);
+
+    while (true) {
+        InputEvent event;
+        // an interrupted wait brings no key, it must not be taken for a typed character
+        if (!read_input_event(reader, -1, &event) || event.key == KEY_NONE) {
+            continue;
+        }
+        if (event.key == KEY_END) {
+            break;
+        }
+        if (event.key == KEY_ENTER || event.character == ' ') {
+            // leading blanks are skipped as by scanf
+            if (typed_count == 0) {
+                continue;
+            }
+            echo(reader, "\n");
+            break;
+        }
+        if (event.key == KEY_BACKSPACE) {
+            if (typed_count > 0) {
+                typed_count--;
+                echo(reader, "\b \b");
+            }
+            continue;
+        }
+
+        char text[2] = {event.character != 0 ? event.character : '?', '\0'};
+        echo(reader, text);
+        if (typed_count < MAX_NUMBER_LENGTH + 2) {
+            typed[typed_count] = text[0];
+        }
+        typed_count++;
+    }
+
+    if (typed_count == 0 || typed_count > MAX_NUMBER_LENGTH + 1) {
+        return false;
+    }
+    typed[typed_count] = '\0';
+    for (int index = 0; index < typed_count; index++) {
+        bool is_sign = index == 0 && typed[index] == '-' && typed_count > 1;
+        if (!is_sign && (typed[index] < '0' || typed[index] > '9')) {
+            return false;
+        }
+    }
+    errno = 0;
+    long number = strtol(typed, NULL, 10);
+    if (errno == ERANGE || number < INT_MIN || number > INT_MAX) {
+        return false;
+    }
+    *value = (int) number;
+    return true;
+}
+
+/**
+ * Move the cursor by an arrow key. On TORUS the cursor goes over the edge
+ * to the opposite side, on other boards it stops at the edge.
+ */
+void move_cursor(Board *board, TilePosition *cursor, InputKey key) {
+    assert(board != NULL);
+    assert(cursor != NULL);
+
+    int row = cursor->row;
+    int column = cursor->column;
+    switch (key) {
+        case KEY_UP:
+            row--;
+            break;
+        case KEY_DOWN:
+            row++;
+            break;
+        case KEY_LEFT:
+            column--;
+            break;
+        case KEY_RIGHT:
+            column++;
+            break;
+        default:
+            return;
+    }
+
+    if (board->topology == TORUS) {
+        row = wrap_coordinate(row, board->row_count);
+        column = wrap_coordinate(column, board->column_count);
+    } else if (!is_input_data_correct(board, row, column)) {
+        return;
+    }
+    cursor->row = row;
+    cursor->column = column;
+}
@@ -0,0 +1,52 @@
+#ifndef MINES_INPUT_H
+#define MINES_INPUT_H
+#include <stdbool.h>
+#include <stdio.h>
+#include <termios.h>
+#include "board.h"
+
+#define INPUT_BUFFER_SIZE 64
+#define MAX_NUMBER_LENGTH 9
+
+typedef enum {
+    KEY_NONE,                    /* No key arrived before the timeout */
+    KEY_UP,
+    KEY_DOWN,
+    KEY_LEFT,
+    KEY_RIGHT,
+    KEY_OPEN,
+    KEY_MARK,
+    KEY_QUIT,
+    KEY_DIGIT,
+    KEY_MINUS,
+    KEY_ENTER,
+    KEY_BACKSPACE,
+    KEY_OTHER,                   /* Any key without a meaning in the game */
+    KEY_END                      /* Input is closed */
+} InputKey;
+
+typedef struct {
+    InputKey key;                /* Meaning of the key */
+    char character;              /* Character of the key, 0 for escape sequences */
+} InputEvent;
+
+typedef struct {
+    int fd;                                 /* File descriptor the keys are read from */
+    FILE *stream;                           /* Stream of fd, read through stdio unless the terminal is raw */
+    bool is_raw;                            /* Records if the terminal was switched to raw mode */
+    struct termios original_mode;           /* Terminal mode to restore when the reader is closed */
+    char buffer[INPUT_BUFFER_SIZE];         /* Bytes read but not parsed yet */
+    int start;                              /* Index of the first unparsed byte */
+    int length;                             /* Number of unparsed bytes */
+} InputReader;
+
+bool open_input_reader(InputReader *reader, int fd);
+bool open_stream_reader(InputReader *reader, FILE *stream);
+void close_input_reader(InputReader *reader);
+InputReader *get_standard_input_reader();
+void close_standard_input_reader();
+bool read_input_event(InputReader *reader, int timeout, InputEvent *event);
+bool read_number(InputReader *reader, int *value);
+void move_cursor(Board *board, TilePosition *cursor, InputKey key);
+
+#endif //MINES_INPUT_H
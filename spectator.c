@@ -0,0 +1,338 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "spectator.h"
+
+typedef struct {
+    FrameHandler handler;        /* Called with every published frame */
+    void *context;               /* Passed to the handler */
+    bool is_active;              /* Records if the slot has a subscriber */
+} Subscriber;
+
+struct SpectatorChannel {
+    Board *board;                                           /* Watched Board, not owned by the channel */
+    int keyframe_interval;                                  /* Deltas published between two keyframes */
+    int deltas_since_keyframe;                              /* Deltas published since the last keyframe */
+    uint32_t sequence;                                      /* Sequence of the last published frame */
+    bool has_published;                                     /* Records if any frame was published */
+    bool is_keyframe_needed;                                /* Records if the next frame must be a keyframe */
+    int published_row_count;                                /* Rows of the Board in the last keyframe */
+    int published_column_count;                             /* Columns of the Board in the last keyframe */
+    Topology published_topology;                            /* Topology of the Board in the last keyframe */
+    unsigned char states[MAX_ROW_COUNT * MAX_COLUMN_COUNT]; /* Visible state of every Tile as last published */
+    Subscriber *subscribers;                                /* Index in the array is the subscriber id */
+    int subscriber_capacity;                                /* Number of slots in subscribers */
+    SpectatorStats stats;                                   /* Counters of published frames */
+};
+
+static void put_u16(unsigned char *data, uint16_t value) {
+    data[0] = (unsigned char) value;
+    data[1] = (unsigned char) (value >> 8);
+}
+
+static void put_u32(unsigned char *data, uint32_t value) {
+    for (int index = 0; index < 4; index++) {
+        data[index] = (unsigned char) (value >> (8 * index));
+    }
+}
+
+static uint16_t get_u16(const unsigned char *data) {
+    return (uint16_t) (data[0] | (data[1] << 8));
+}
+
+static uint32_t get_u32(const unsigned char *data) {
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static unsigned long long get_nanoseconds() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long) time.tv_sec * 1000000000ULL + (unsigned long long) time.tv_nsec;
+}
+
+/**
+ * Allocate frame for size bytes, owned by the caller.
+ * @return pointer of the frame, or NULL if memory allocation fails
+ */
+static SpectatorFrame *create_frame(size_t size, FrameType type, uint32_t sequence) {
+    SpectatorFrame *frame = (SpectatorFrame *) malloc(sizeof(SpectatorFrame) + size);
+    if (frame == NULL) return NULL;
+
+    atomic_init(&frame->reference_count, 1);
+    frame->size = size;
+    frame->data[0] = (unsigned char) type;
+    put_u32(frame->data + 1, sequence);
+    return frame;
+}
+
+/**
+ * Encode the published state of all tiles.
+ * @return keyframe owned by the caller, or NULL if memory allocation fails
+ */
+static SpectatorFrame *encode_keyframe(SpectatorChannel *channel) {
+    Board *board = channel->board;
+    int tile_count = board->row_count * board->column_count;
+    SpectatorFrame *frame = create_frame(KEYFRAME_HEADER_SIZE + (tile_count + 1) / 2, KEYFRAME, channel->sequence);
+    if (frame == NULL) return NULL;
+
+    frame->data[FRAME_HEADER_SIZE] = (unsigned char) board->row_count;
+    frame->data[FRAME_HEADER_SIZE + 1] = (unsigned char) board->column_count;
+    frame->data[FRAME_HEADER_SIZE + 2] = (unsigned char) board->topology;
+    unsigned char *packed = frame->data + KEYFRAME_HEADER_SIZE;
+    memset(packed, 0, (tile_count + 1) / 2);
+    for (int index = 0; index < tile_count; index++) {
+        packed[index / 2] |= (unsigned char) (channel->states[index] << (4 * (index % 2)));
+    }
+    return frame;
+}
+
+/**
+ * Create channel which publishes moves on the Board. The Board must outlive the channel.
+ * @param keyframe_interval number of deltas published between two keyframes
+ * @return pointer of the channel, or NULL if parameters are invalid or memory allocation fails
+ */
+SpectatorChannel *create_spectator_channel(Board *board, int keyframe_interval) {
+    if (board == NULL || keyframe_interval <= 0) {
+        return NULL;
+    }
+
+    SpectatorChannel *channel = (SpectatorChannel *) calloc(1, sizeof(SpectatorChannel));
+    if (channel == NULL) return NULL;
+
+    channel->board = board;
+    channel->keyframe_interval = keyframe_interval;
+    return channel;
+}
+
+/**
+ * Free the channel. Frames retained by subscribers stay valid until they are released.
+ */
+void destroy_spectator_channel(SpectatorChannel *channel) {
+    assert(channel != NULL);
+    free(channel->subscribers);
+    free(channel);
+}
+
+/**
+ * Add subscriber. If anything was published already, the subscriber gets
+ * a keyframe of the current state at once, so it can apply the following deltas.
+ * @return id of the subscriber, or -1 if memory allocation fails
+ */
+int subscribe_spectator(SpectatorChannel *channel, FrameHandler handler, void *context) {
+    assert(channel != NULL);
+    assert(handler != NULL);
+
+    int subscriber = 0;
+    while (subscriber < channel->subscriber_capacity && channel->subscribers[subscriber].is_active) {
+        subscriber++;
+    }
+    if (subscriber == channel->subscriber_capacity) {
+        int capacity = channel->subscriber_capacity == 0 ? 16 : 2 * channel->subscriber_capacity;
+        Subscriber *subscribers = (Subscriber *) realloc(channel->subscribers, capacity * sizeof(Subscriber));
+        if (subscribers == NULL) {
+            return -1;
+        }
+        memset(subscribers + channel->subscriber_capacity, 0,
+               (capacity - channel->subscriber_capacity) * sizeof(Subscriber));
+        channel->subscribers = subscribers;
+        channel->subscriber_capacity = capacity;
+    }
+
+    if (channel->has_published) {
+        SpectatorFrame *keyframe = encode_keyframe(channel);
+        if (keyframe == NULL) {
+            return -1;
+        }
+        handler(keyframe, context);
+        release_frame(keyframe);
+    }
+
+    channel->subscribers[subscriber].handler = handler;
+    channel->subscribers[subscriber].context = context;
+    channel->subscribers[subscriber].is_active = true;
+    return subscriber;
+}
+
+/**
+ * Remove subscriber, it gets no more frames.
+ */
+void unsubscribe_spectator(SpectatorChannel *channel, int subscriber) {
+    assert(channel != NULL);
+    if (subscriber >= 0 && subscriber < channel->subscriber_capacity) {
+        channel->subscribers[subscriber].is_active = false;
+    }
+}
+
+/**
+ * Encode changes on the Board since the last published frame and hand the frame to every subscriber.
+ * The frame is encoded once and the same bytes are shared by all subscribers. A keyframe is
+ * published first, after every keyframe_interval deltas, whenever it is smaller than the delta,
+ * and when the size or topology of the Board changed.
+ * Every Tile is compared with its published state, so changes made without set_tile_state are sent too.
+ * @return true if a frame was published, false if nothing changed or memory allocation fails
+ */
+bool publish_move(SpectatorChannel *channel) {
+    assert(channel != NULL);
+
+    Board *board = channel->board;
+    if (board->row_count != channel->published_row_count || board->column_count != channel->published_column_count
+        || board->topology != channel->published_topology) {
+        channel->is_keyframe_needed = true;
+    }
+
+    unsigned long long start = get_nanoseconds();
+    uint16_t changes[MAX_ROW_COUNT * MAX_COLUMN_COUNT];
+    int change_count = 0;
+    int tile_count = board->row_count * board->column_count;
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            int index = row * board->column_count + column;
+            unsigned char state = (unsigned char) get_visible_tile_state(board->tiles[row][column]);
+            if (state != channel->states[index]) {
+                channel->states[index] = state;
+                changes[change_count] = (uint16_t) (index << 4 | state);
+                change_count++;
+            }
+        }
+    }
+    if (change_count == 0 && channel->has_published && !channel->is_keyframe_needed) {
+        return false;
+    }
+
+    size_t keyframe_size = KEYFRAME_HEADER_SIZE + (tile_count + 1) / 2;
+    size_t delta_size = DELTA_HEADER_SIZE + (size_t) change_count * DELTA_ENTRY_SIZE;
+    bool is_keyframe = !channel->has_published || channel->is_keyframe_needed
+                       || channel->deltas_since_keyframe >= channel->keyframe_interval || keyframe_size <= delta_size;
+
+    channel->sequence++;
+    SpectatorFrame *frame;
+    if (is_keyframe) {
+        frame = encode_keyframe(channel);
+    } else {
+        frame = create_frame(delta_size, DELTA, channel->sequence);
+        if (frame != NULL) {
+            put_u16(frame->data + FRAME_HEADER_SIZE, (uint16_t) change_count);
+            for (int index = 0; index < change_count; index++) {
+                put_u16(frame->data + DELTA_HEADER_SIZE + index * DELTA_ENTRY_SIZE, changes[index]);
+            }
+        }
+    }
+    if (frame == NULL) {
+        // published states are already updated, so the next frame must be a keyframe
+        channel->sequence--;
+        channel->is_keyframe_needed = true;
+        return false;
+    }
+
+    channel->has_published = true;
+    channel->is_keyframe_needed = false;
+    if (is_keyframe) {
+        channel->published_row_count = board->row_count;
+        channel->published_column_count = board->column_count;
+        channel->published_topology = board->topology;
+    }
+    channel->deltas_since_keyframe = is_keyframe ? 0 : channel->deltas_since_keyframe + 1;
+    channel->stats.frame_count++;
+    channel->stats.keyframe_count += is_keyframe ? 1 : 0;
+    channel->stats.encoded_bytes += frame->size;
+    channel->stats.encode_nanoseconds += get_nanoseconds() - start;
+
+    for (int subscriber = 0; subscriber < channel->subscriber_capacity; subscriber++) {
+        if (channel->subscribers[subscriber].is_active) {
+            channel->subscribers[subscriber].handler(frame, channel->subscribers[subscriber].context);
+            channel->stats.delivered_frames++;
+        }
+    }
+    release_frame(frame);
+    return true;
+}
+
+/**
+ * @return snapshot of the channel counters
+ */
+SpectatorStats get_spectator_stats(SpectatorChannel *channel) {
+    assert(channel != NULL);
+    return channel->stats;
+}
+
+/**
+ * Keep the frame after the handler returns. Every retain needs one release_frame.
+ */
+void retain_frame(SpectatorFrame *frame) {
+    assert(frame != NULL);
+    atomic_fetch_add_explicit(&frame->reference_count, 1, memory_order_relaxed);
+}
+
+/**
+ * Drop one reference, the last one frees the frame. Safe to call from any thread.
+ */
+void release_frame(SpectatorFrame *frame) {
+    assert(frame != NULL);
+    if (atomic_fetch_sub_explicit(&frame->reference_count, 1, memory_order_acq_rel) == 1) {
+        free(frame);
+    }
+}
+
+/**
+ * Update viewer copy of the Board by the frame.
+ * A delta which does not directly follow the last applied frame is rejected,
+ * and the view waits for the next keyframe.
+ * @return true if the frame was applied, false if it is malformed or out of sequence
+ */
+bool apply_spectator_frame(SpectatorView *view, const SpectatorFrame *frame) {
+    assert(view != NULL);
+    assert(frame != NULL);
+
+    if (frame->size < FRAME_HEADER_SIZE) {
+        return false;
+    }
+    const unsigned char *data = frame->data;
+    uint32_t sequence = get_u32(data + 1);
+
+    if (data[0] == KEYFRAME) {
+        if (frame->size < KEYFRAME_HEADER_SIZE) {
+            return false;
+        }
+        int row_count = data[FRAME_HEADER_SIZE];
+        int column_count = data[FRAME_HEADER_SIZE + 1];
+        int tile_count = row_count * column_count;
+        if (row_count > MAX_ROW_COUNT || column_count > MAX_COLUMN_COUNT
+            || frame->size != KEYFRAME_HEADER_SIZE + (size_t) (tile_count + 1) / 2) {
+            return false;
+        }
+        view->row_count = row_count;
+        view->column_count = column_count;
+        view->topology = (Topology) data[FRAME_HEADER_SIZE + 2];
+        for (int index = 0; index < tile_count; index++) {
+            view->states[index] = (data[KEYFRAME_HEADER_SIZE + index / 2] >> (4 * (index % 2))) & 0x0f;
+        }
+        view->sequence = sequence;
+        view->is_synchronized = true;
+        return true;
+    }
+
+    if (data[0] != DELTA || frame->size < DELTA_HEADER_SIZE) {
+        return false;
+    }
+    if (!view->is_synchronized || sequence != view->sequence + 1) {
+        view->is_synchronized = false;
+        return false;
+    }
+    int change_count = get_u16(data + FRAME_HEADER_SIZE);
+    if (frame->size != DELTA_HEADER_SIZE + (size_t) change_count * DELTA_ENTRY_SIZE) {
+        return false;
+    }
+    for (int change = 0; change < change_count; change++) {
+        uint16_t entry = get_u16(data + DELTA_HEADER_SIZE + change * DELTA_ENTRY_SIZE);
+        int index = entry >> 4;
+        if (index >= view->row_count * view->column_count || (entry & 0x0f) >= VISIBLE_STATE_COUNT) {
+            view->is_synchronized = false;
+            return false;
+        }
+        view->states[index] = entry & 0x0f;
+    }
+    view->sequence = sequence;
+    return true;
+}
@@ -0,0 +1,64 @@
+#ifndef MINES_SPECTATOR_H
+#define MINES_SPECTATOR_H
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "board.h"
+
+/*
+ * Frame format, multi-byte numbers are little endian:
+ *   header:   type (1 byte), sequence (4 bytes)
+ *   KEYFRAME: row count (1), column count (1), topology (1),
+ *             visible state of every Tile packed two per byte, row by row
+ *   DELTA:    changed tile count (2), then for every changed Tile
+ *             (row * column_count + column) << 4 | visible state (2)
+ */
+#define FRAME_HEADER_SIZE 5
+#define KEYFRAME_HEADER_SIZE (FRAME_HEADER_SIZE + 3)
+#define DELTA_HEADER_SIZE (FRAME_HEADER_SIZE + 2)
+#define DELTA_ENTRY_SIZE 2
+
+typedef enum {
+    KEYFRAME = 1,
+    DELTA = 2
+} FrameType;
+
+typedef struct {
+    atomic_int reference_count;  /* Frame is freed when the last holder releases it */
+    size_t size;                 /* Number of encoded bytes in data */
+    unsigned char data[];        /* Encoded frame, shared by all subscribers */
+} SpectatorFrame;
+
+/* Receives every published frame. The frame is valid during the call, retain it to keep it longer */
+typedef void (*FrameHandler)(SpectatorFrame *frame, void *context);
+
+typedef struct {
+    unsigned long long frame_count;          /* Published frames */
+    unsigned long long keyframe_count;       /* Published frames which are keyframes */
+    unsigned long long encoded_bytes;        /* Bytes of all published frames */
+    unsigned long long encode_nanoseconds;   /* Time spent on encoding, without delivery */
+    unsigned long long delivered_frames;     /* Frames handed to subscribers */
+} SpectatorStats;
+
+typedef struct {
+    int row_count;                                          /* Rows of the watched Board */
+    int column_count;                                       /* Columns of the watched Board */
+    Topology topology;                                      /* Topology of the watched Board */
+    uint32_t sequence;                                      /* Sequence of the last applied frame */
+    bool is_synchronized;                                   /* Records if a keyframe was applied since the last gap */
+    unsigned char states[MAX_ROW_COUNT * MAX_COLUMN_COUNT]; /* Visible state of every Tile */
+} SpectatorView;
+
+typedef struct SpectatorChannel SpectatorChannel;
+
+SpectatorChannel *create_spectator_channel(Board *board, int keyframe_interval);
+void destroy_spectator_channel(SpectatorChannel *channel);
+int subscribe_spectator(SpectatorChannel *channel, FrameHandler handler, void *context);
+void unsubscribe_spectator(SpectatorChannel *channel, int subscriber);
+bool publish_move(SpectatorChannel *channel);
+SpectatorStats get_spectator_stats(SpectatorChannel *channel);
+void retain_frame(SpectatorFrame *frame);
+void release_frame(SpectatorFrame *frame);
+bool apply_spectator_frame(SpectatorView *view, const SpectatorFrame *frame);
+
+#endif //MINES_SPECTATOR_H
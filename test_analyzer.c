@@ -0,0 +1,127 @@
+#include "greatest.h"
+#include "../board.h"
+#include "../analyzer.h"
+
+TEST analyze_board_single_opening() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    set_tile_values(board);
+
+    BoardMetrics metrics = analyze_board(board);
+    ASSERT_EQ(1, metrics.opening_count);
+    ASSERT_EQ(0, metrics.isolated_number_count);
+    ASSERT_EQ(1, metrics.three_bv);
+    destroy_board(board);
+    PASS();
+}
+
+TEST analyze_board_diagonal_zeros_are_one_opening() {
+    Board *board = create_board(4, 4, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 3);
+    place_mine(board, 3, 0);
+    set_tile_values(board);
+
+    // upper left and lower right zero regions touch only through tiles [1][1] and [2][2]
+    BoardMetrics metrics = analyze_board(board);
+    ASSERT_EQ(1, metrics.opening_count);
+    ASSERT_EQ(0, metrics.isolated_number_count);
+    ASSERT_EQ(1, metrics.three_bv);
+    destroy_board(board);
+    PASS();
+}
+
+TEST analyze_board_without_zeros() {
+    Board *board = create_board(2, 2, 1);
+    ASSERT(board != NULL);
+    place_mine(board, 1, 1);
+    set_tile_values(board);
+
+    BoardMetrics metrics = analyze_board(board);
+    ASSERT_EQ(0, metrics.opening_count);
+    ASSERT_EQ(3, metrics.isolated_number_count);
+    ASSERT_EQ(3, metrics.three_bv);
+    destroy_board(board);
+    PASS();
+}
+
+TEST analyze_board_joins_openings_over_torus_edge() {
+    Board *board = create_board(3, 7, 3);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, TORUS));
+    place_mine(board, 0, 3);
+    place_mine(board, 1, 3);
+    place_mine(board, 2, 3);
+    set_tile_values(board);
+
+    // zeros in columns 0 and 1 are joined with zeros in columns 5 and 6 only over the edge
+    BoardMetrics metrics = analyze_board(board);
+    ASSERT_EQ(1, metrics.opening_count);
+    ASSERT_EQ(0, metrics.isolated_number_count);
+    ASSERT_EQ(1, metrics.three_bv);
+    destroy_board(board);
+    PASS();
+}
+
+TEST set_mines_with_seed_is_repeatable() {
+    Board *first = create_board(8, 8, 10);
+    Board *second = create_board(8, 8, 10);
+    ASSERT(first != NULL && second != NULL);
+    set_mines_with_seed(first, 42, 3, 3);
+    set_mines_with_seed(second, 42, 3, 3);
+
+    ASSERT_EQ(10, first->placed_mine_count);
+    ASSERT_FALSE(first->tiles[3][3]->is_mine);
+    for (int row = 0; row < first->row_count; row++) {
+        for (int column = 0; column < first->column_count; column++) {
+            ASSERT_EQ(first->tiles[row][column]->is_mine, second->tiles[row][column]->is_mine);
+        }
+    }
+    destroy_board(first);
+    destroy_board(second);
+    PASS();
+}
+
+TEST analyze_corpus_writes_line_per_seed() {
+    FILE *output = tmpfile();
+    ASSERT(output != NULL);
+    CorpusParameters parameters = {9, 9, 10, 100, 1000, 4};
+    ASSERT(analyze_corpus(&parameters, output));
+
+    rewind(output);
+    char line[128];
+    ASSERT(fgets(line, sizeof(line), output) != NULL);
+    ASSERT_STR_EQ("seed,three_bv,opening_count,isolated_number_count\n", line);
+
+    int line_count = 0;
+    unsigned int seed;
+    int three_bv, opening_count, isolated_number_count;
+    while (fscanf(output, "%u,%d,%d,%d\n", &seed, &three_bv, &opening_count, &isolated_number_count) == 4) {
+        ASSERT(seed >= 100 && seed < 1100);
+        ASSERT_EQ(three_bv, opening_count + isolated_number_count);
+        line_count++;
+    }
+    ASSERT_EQ(1000, line_count);
+    fclose(output);
+    PASS();
+}
+
+TEST analyze_corpus_invalid_parameters() {
+    FILE *output = tmpfile();
+    ASSERT(output != NULL);
+    CorpusParameters parameters = {31, 9, 10, 0, 10, 2};
+    ASSERT_FALSE(analyze_corpus(&parameters, output));
+    fclose(output);
+    PASS();
+}
+
+SUITE(test_analyzer) {
+    RUN_TEST(analyze_board_single_opening);
+    RUN_TEST(analyze_board_diagonal_zeros_are_one_opening);
+    RUN_TEST(analyze_board_without_zeros);
+    RUN_TEST(analyze_board_joins_openings_over_torus_edge);
+    RUN_TEST(set_mines_with_seed_is_repeatable);
+    RUN_TEST(analyze_corpus_writes_line_per_seed);
+    RUN_TEST(analyze_corpus_invalid_parameters);
+}
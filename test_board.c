@@ -90,7 +90,7 @@ TEST open_mines_after_loss() {
 TEST is_mine_on_returns_true_for_mine() {
     Board *board = create_board(5, 5, 1);
     ASSERT(board != NULL);
-    board->tiles[2][3]->is_mine = true;
+    place_mine(board, 2, 3);
 
     ASSERT(is_mine_on(board, 2, 3));
     destroy_board(board);
@@ -118,17 +118,30 @@ TEST is_mine_on_out_of_bounds_returns_false() {
 TEST count_neighbour_mines_with_single_mine_nearby() {
     Board *board = create_board(3, 3, 1);
     ASSERT(board != NULL);
-    board->tiles[0][0]->is_mine = true;
+    place_mine(board, 0, 0);
     int count = count_neighbour_mines(board, 1, 1);
     ASSERT_EQ(1, count);
     destroy_board(board);
     PASS();
 }
 
+TEST count_neighbour_mines_counts_mined_tile_itself() {
+    Board *board = create_board(3, 3, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 1, 1);
+    place_mine(board, 0, 0);
+    ASSERT_EQ(2, count_neighbour_mines(board, 1, 1));
+    ASSERT(set_board_topology(board, TORUS));
+    ASSERT_EQ(2, count_neighbour_mines(board, 1, 1));
+    ASSERT_EQ(2, count_neighbour_mines(board, 4, -2));
+    destroy_board(board);
+    PASS();
+}
+
 TEST set_tile_values_sets_correct_values() {
     Board *board = create_board(3, 3, 1);
     ASSERT(board != NULL);
-    board->tiles[0][0]->is_mine = true;
+    place_mine(board, 0, 0);
     set_tile_values(board);
     ASSERT_EQ(-1, board->tiles[0][0]->value);
     ASSERT_EQ(1, board->tiles[0][1]->value);
@@ -141,6 +154,7 @@ TEST set_tile_values_sets_correct_values() {
 TEST mark_all_mines_marks_closed_tiles() {
     Board *board = create_board(3, 3, 1);
     ASSERT(board != NULL);
+    place_mine(board, 0, 0);
     board->tiles[0][0]->tile_state = CLOSED;
     board->tiles[0][1]->tile_state = OPEN;
     mark_all_mines(board);
@@ -150,6 +164,194 @@ TEST mark_all_mines_marks_closed_tiles() {
     PASS();
 }
 
+TEST place_mine_records_coordinates() {
+    Board *board = create_board(3, 3, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 1, 2);
+    place_mine(board, 1, 2);
+    ASSERT(board->tiles[1][2]->is_mine);
+    ASSERT_EQ(1, board->placed_mine_count);
+    ASSERT_EQ(1, board->mines[0].row);
+    ASSERT_EQ(2, board->mines[0].column);
+    destroy_board(board);
+    PASS();
+}
+
+TEST remove_mine_keeps_index_correct() {
+    Board *board = create_board(3, 3, 3);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    place_mine(board, 1, 1);
+    place_mine(board, 2, 2);
+    remove_mine(board, 0, 0);
+    ASSERT_FALSE(board->tiles[0][0]->is_mine);
+    ASSERT_EQ(2, board->placed_mine_count);
+    for (int index = 0; index < board->placed_mine_count; index++) {
+        ASSERT(board->tiles[board->mines[index].row][board->mines[index].column]->is_mine);
+    }
+    open_all_mines(board);
+    ASSERT_EQ(CLOSED, board->tiles[0][0]->tile_state);
+    ASSERT_EQ(OPEN, board->tiles[1][1]->tile_state);
+    ASSERT_EQ(OPEN, board->tiles[2][2]->tile_state);
+    destroy_board(board);
+    PASS();
+}
+
+TEST is_mine_index_correct_detects_direct_write() {
+    Board *board = create_board(3, 3, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    ASSERT(is_mine_index_correct(board));
+    board->tiles[1][1]->is_mine = true;
+    ASSERT_FALSE(is_mine_index_correct(board));
+    board->tiles[1][1]->is_mine = false;
+    board->tiles[0][0]->is_mine = false;
+    ASSERT_FALSE(is_mine_index_correct(board));
+    destroy_board(board);
+    PASS();
+}
+
+TEST set_mines_randomly_fills_mine_index() {
+    Board *board = create_board(5, 5, 5);
+    ASSERT(board != NULL);
+    set_mines_randomly(board, 2, 2);
+    ASSERT_EQ(5, board->placed_mine_count);
+    for (int index = 0; index < board->placed_mine_count; index++) {
+        ASSERT(board->tiles[board->mines[index].row][board->mines[index].column]->is_mine);
+    }
+    destroy_board(board);
+    PASS();
+}
+
+TEST set_tile_state_keeps_hash_up_to_date() {
+    Board *board = create_board(4, 4, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    place_mine(board, 3, 3);
+    set_tile_values(board);
+    ASSERT_EQ(compute_board_hash(board), board->hash);
+
+    set_tile_state(board, 1, 2, OPEN);
+    set_tile_state(board, 0, 0, MARKED);
+    ASSERT_EQ(compute_board_hash(board), board->hash);
+    open_all_mines(board);
+    ASSERT_EQ(compute_board_hash(board), board->hash);
+    destroy_board(board);
+    PASS();
+}
+
+TEST board_hash_depends_only_on_visible_state() {
+    Board *first = create_board(4, 4, 2);
+    Board *second = create_board(4, 4, 2);
+    ASSERT(first != NULL && second != NULL);
+    place_mine(first, 0, 0);
+    place_mine(second, 0, 1);
+    set_tile_values(first);
+    set_tile_values(second);
+
+    // tile [3][3] has value 0 on both boards, different hidden mines do not matter
+    set_tile_state(first, 3, 3, OPEN);
+    set_tile_state(second, 3, 3, OPEN);
+    ASSERT_EQ(first->hash, second->hash);
+
+    set_tile_state(second, 3, 3, CLOSED);
+    set_tile_state(second, 2, 3, OPEN);
+    ASSERT(first->hash != second->hash);
+
+    set_tile_state(second, 2, 3, CLOSED);
+    ASSERT_EQ(compute_board_hash(second), second->hash);
+    destroy_board(first);
+    destroy_board(second);
+    PASS();
+}
+
+TEST set_tile_values_on_torus_wraps_around() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, TORUS));
+    place_mine(board, 0, 0);
+    set_tile_values(board);
+    ASSERT_EQ(1, board->tiles[2][2]->value);
+    ASSERT_EQ(1, board->tiles[0][2]->value);
+    ASSERT_EQ(1, board->tiles[2][1]->value);
+    ASSERT(is_mine_on(board, 3, -3));
+    destroy_board(board);
+    PASS();
+}
+
+TEST set_board_topology_rejects_small_torus() {
+    Board *board = create_board(2, 5, 1);
+    ASSERT(board != NULL);
+    ASSERT_FALSE(set_board_topology(board, TORUS));
+    ASSERT_EQ(RECTANGLE, board->topology);
+    destroy_board(board);
+    PASS();
+}
+
+TEST set_tile_values_on_hexagon_uses_six_neighbours() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, HEXAGON));
+    place_mine(board, 1, 1);
+    set_tile_values(board);
+    ASSERT_EQ(0, board->tiles[0][0]->value);
+    ASSERT_EQ(1, board->tiles[0][1]->value);
+    ASSERT_EQ(1, board->tiles[0][2]->value);
+    ASSERT_EQ(1, board->tiles[1][0]->value);
+    ASSERT_EQ(0, board->tiles[2][0]->value);
+    ASSERT_EQ(1, board->tiles[2][2]->value);
+    destroy_board(board);
+    PASS();
+}
+
+TEST board_hash_depends_on_topology() {
+    Board *rectangle = create_board(5, 5, 1);
+    Board *torus = create_board(5, 5, 1);
+    ASSERT(rectangle != NULL && torus != NULL);
+    ASSERT(set_board_topology(torus, TORUS));
+    ASSERT(rectangle->hash != torus->hash);
+    ASSERT_EQ(compute_board_hash(torus), torus->hash);
+
+    place_mine(rectangle, 0, 0);
+    place_mine(torus, 0, 0);
+    set_tile_values(rectangle);
+    set_tile_values(torus);
+    set_tile_state(rectangle, 2, 2, OPEN);
+    set_tile_state(torus, 2, 2, OPEN);
+    ASSERT(rectangle->hash != torus->hash);
+    destroy_board(rectangle);
+    destroy_board(torus);
+    PASS();
+}
+
+TEST open_tile_opens_zero_region() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    set_tile_values(board);
+    ASSERT_EQ(8, open_tile(board, 2, 2));
+    ASSERT_EQ(CLOSED, board->tiles[0][0]->tile_state);
+    ASSERT(is_game_solved(board));
+    ASSERT_EQ(compute_board_hash(board), board->hash);
+    destroy_board(board);
+    PASS();
+}
+
+TEST open_tile_follows_hexagon_neighbours() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, HEXAGON));
+    place_mine(board, 1, 1);
+    set_tile_values(board);
+    ASSERT_EQ(3, open_tile(board, 0, 0));
+    ASSERT_EQ(OPEN, board->tiles[0][1]->tile_state);
+    ASSERT_EQ(OPEN, board->tiles[1][0]->tile_state);
+    ASSERT_EQ(CLOSED, board->tiles[0][2]->tile_state);
+    ASSERT_EQ(0, open_tile(board, 0, 0));
+    destroy_board(board);
+    PASS();
+}
+
 TEST generate_random_coordinates_within_range() {
     srand(0);
     for (int i = 0; i < 100; i++) {
@@ -182,8 +384,8 @@ TEST set_mines_randomly_sets_correct_mine_count() {
 TEST set_mines_randomly_skips_already_mined() {
     Board *board = create_board(2, 2, 1);
     ASSERT(board != NULL);
-    board->tiles[0][0]->is_mine = true;
-    board->tiles[0][1]->is_mine = true;
+    place_mine(board, 0, 0);
+    place_mine(board, 0, 1);
     srand(0);
     set_mines_randomly(board, 1, 1);
     int mine_count = 0;
@@ -196,6 +398,8 @@ TEST set_mines_randomly_skips_already_mined() {
         }
     }
     ASSERT_EQ(3, mine_count);
+    ASSERT_EQ(3, board->placed_mine_count);
+    ASSERT(is_mine_index_correct(board));
     destroy_board(board);
     PASS();
 }
@@ -316,6 +520,40 @@ TEST create_interactive_board_invalid_mine_count_too_large() {
     PASS();
 }
 
+TEST input_board_parameters_after_stdio_read() {
+    FILE *input_file = fopen("test_input.txt", "w");
+    ASSERT(input_file != NULL);
+    fprintf(input_file, "alice\n5\n6\n7\nbob\n");
+    fclose(input_file);
+
+    input_file = fopen("test_input.txt", "r");
+    ASSERT(input_file != NULL);
+    FILE *original_stdin = stdin;
+    stdin = input_file;
+    // stdio buffers the whole file on the first read, the parameters must still be found
+    char name[32] = "";
+    int name_count = scanf("%31s", name);
+    int row_count = 0;
+    int column_count = 0;
+    int mine_count = 0;
+    bool is_read = input_board_parameters(&row_count, &column_count, &mine_count);
+    char next_name[32] = "";
+    int next_name_count = scanf("%31s", next_name);
+    stdin = original_stdin;
+    fclose(input_file);
+    remove("test_input.txt");
+
+    ASSERT_EQ(1, name_count);
+    ASSERT_STR_EQ("alice", name);
+    ASSERT(is_read);
+    ASSERT_EQ(5, row_count);
+    ASSERT_EQ(6, column_count);
+    ASSERT_EQ(7, mine_count);
+    ASSERT_EQ(1, next_name_count);
+    ASSERT_STR_EQ("bob", next_name);
+    PASS();
+}
+
 SUITE(test_board) {
     RUN_TEST(verify_with_high_coordinates);
     RUN_TEST(verify_with_low_coordinates);
@@ -327,8 +565,21 @@ SUITE(test_board) {
     RUN_TEST(is_mine_on_returns_false_for_non_mine);
     RUN_TEST(is_mine_on_out_of_bounds_returns_false);
     RUN_TEST(count_neighbour_mines_with_single_mine_nearby);
+    RUN_TEST(count_neighbour_mines_counts_mined_tile_itself);
     RUN_TEST(set_tile_values_sets_correct_values);
     RUN_TEST(mark_all_mines_marks_closed_tiles);
+    RUN_TEST(place_mine_records_coordinates);
+    RUN_TEST(remove_mine_keeps_index_correct);
+    RUN_TEST(is_mine_index_correct_detects_direct_write);
+    RUN_TEST(set_mines_randomly_fills_mine_index);
+    RUN_TEST(set_tile_state_keeps_hash_up_to_date);
+    RUN_TEST(board_hash_depends_only_on_visible_state);
+    RUN_TEST(set_tile_values_on_torus_wraps_around);
+    RUN_TEST(set_board_topology_rejects_small_torus);
+    RUN_TEST(set_tile_values_on_hexagon_uses_six_neighbours);
+    RUN_TEST(board_hash_depends_on_topology);
+    RUN_TEST(open_tile_opens_zero_region);
+    RUN_TEST(open_tile_follows_hexagon_neighbours);
     RUN_TEST(generate_random_coordinates_within_range);
     RUN_TEST(set_mines_randomly_sets_correct_mine_count);
     RUN_TEST(set_mines_randomly_skips_already_mined);
@@ -338,4 +589,5 @@ SUITE(test_board) {
     RUN_TEST(create_interactive_board_invalid_col_count);
     RUN_TEST(create_interactive_board_invalid_mine_count);
     RUN_TEST(create_interactive_board_invalid_mine_count_too_large);
+    RUN_TEST(input_board_parameters_after_stdio_read);
 }
@@ -0,0 +1,274 @@
+#define _XOPEN_SOURCE 700
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "greatest.h"
+#include "../board.h"
+#include "../input.h"
+
+static bool open_test_reader(InputReader *reader, int fds[2], const char *text) {
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    ssize_t written = write(fds[1], text, strlen(text));
+    close(fds[1]);
+    return written == (ssize_t) strlen(text) && open_input_reader(reader, fds[0]);
+}
+
+TEST read_input_event_decodes_keys() {
+    InputReader reader;
+    int fds[2];
+    ASSERT(open_test_reader(&reader, fds, "\033[A\033[Dk f7\n\033[3~\033OB\033[1;5C\033OP\033q"));
+
+    InputKey expected[] = {KEY_UP, KEY_LEFT, KEY_UP, KEY_OPEN, KEY_MARK, KEY_DIGIT, KEY_ENTER,
+                           KEY_OTHER, KEY_DOWN, KEY_OTHER, KEY_OTHER, KEY_QUIT, KEY_QUIT, KEY_END};
+    for (int index = 0; index < 14; index++) {
+        InputEvent event;
+        ASSERT(read_input_event(&reader, 0, &event));
+        ASSERT_EQ(expected[index], event.key);
+    }
+    close_input_reader(&reader);
+    close(fds[0]);
+    PASS();
+}
+
+TEST read_input_event_times_out_without_key() {
+    int fds[2];
+    ASSERT(pipe(fds) == 0);
+    InputReader reader;
+    ASSERT(open_input_reader(&reader, fds[0]));
+
+    InputEvent event;
+    ASSERT_FALSE(read_input_event(&reader, 0, &event));
+    ASSERT_EQ(KEY_NONE, event.key);
+    close_input_reader(&reader);
+    close(fds[0]);
+    close(fds[1]);
+    PASS();
+}
+
+TEST read_number_consumes_malformed_input() {
+    InputReader reader;
+    int fds[2];
+    ASSERT(open_test_reader(&reader, fds, "\n12x4\n-7 30\n5-\n"));
+
+    int value = 0;
+    ASSERT_FALSE(read_number(&reader, &value));
+    ASSERT(read_number(&reader, &value));
+    ASSERT_EQ(-7, value);
+    ASSERT(read_number(&reader, &value));
+    ASSERT_EQ(30, value);
+    ASSERT_FALSE(read_number(&reader, &value));
+    ASSERT_FALSE(read_number(&reader, &value));
+    close_input_reader(&reader);
+    close(fds[0]);
+    PASS();
+}
+
+TEST read_number_accepts_erased_mistake() {
+    InputReader reader;
+    int fds[2];
+    ASSERT(open_test_reader(&reader, fds, "1x\1772\n"));
+
+    int value = 0;
+    ASSERT(read_number(&reader, &value));
+    ASSERT_EQ(12, value);
+    close_input_reader(&reader);
+    close(fds[0]);
+    PASS();
+}
+
+TEST read_number_rejects_int_overflow() {
+    InputReader reader;
+    int fds[2];
+    ASSERT(open_test_reader(&reader, fds, "4294967297\n-2147483649\n2147483647\n"));
+
+    int value = 0;
+    ASSERT_FALSE(read_number(&reader, &value));
+    ASSERT_FALSE(read_number(&reader, &value));
+    ASSERT_EQ(0, value);
+    ASSERT(read_number(&reader, &value));
+    ASSERT_EQ(2147483647, value);
+    close_input_reader(&reader);
+    close(fds[0]);
+    PASS();
+}
+
+typedef struct {
+    pthread_t reader_thread;
+    int fd;
+} LateWriter;
+
+static void ignore_signal(int signal_number) {
+    (void) signal_number;
+}
+
+static void *interrupt_then_write(void *argument) {
+    LateWriter *writer = (LateWriter *) argument;
+    struct timespec delay = {0, 50000000};
+    nanosleep(&delay, NULL);
+    pthread_kill(writer->reader_thread, SIGUSR1);
+    nanosleep(&delay, NULL);
+    ssize_t written = write(writer->fd, "12\n", 3);
+    (void) written;
+    return NULL;
+}
+
+TEST read_number_survives_interrupted_wait() {
+    int fds[2];
+    ASSERT(pipe(fds) == 0);
+    InputReader reader;
+    ASSERT(open_input_reader(&reader, fds[0]));
+
+    struct sigaction action;
+    struct sigaction original_action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = ignore_signal;
+    sigaction(SIGUSR1, &action, &original_action);
+
+    LateWriter writer = {pthread_self(), fds[1]};
+    pthread_t writer_thread;
+    ASSERT(pthread_create(&writer_thread, NULL, interrupt_then_write, &writer) == 0);
+    int value = 0;
+    bool is_read = read_number(&reader, &value);
+    pthread_join(writer_thread, NULL);
+    sigaction(SIGUSR1, &original_action, NULL);
+
+    ASSERT(is_read);
+    ASSERT_EQ(12, value);
+    close_input_reader(&reader);
+    close(fds[0]);
+    close(fds[1]);
+    PASS();
+}
+
+static bool open_test_terminal(int *master, int *slave) {
+    *master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (*master < 0) {
+        return false;
+    }
+    if (grantpt(*master) != 0 || unlockpt(*master) != 0
+        || (*slave = open(ptsname(*master), O_RDWR | O_NOCTTY)) < 0) {
+        close(*master);
+        return false;
+    }
+    return true;
+}
+
+static bool is_echo_on(int fd) {
+    struct termios mode;
+    return tcgetattr(fd, &mode) == 0 && (mode.c_lflag & ECHO) != 0;
+}
+
+static int signalled_terminal = -1;
+static volatile sig_atomic_t was_echo_on_in_handler = 0;
+
+static void check_terminal_mode(int signal_number) {
+    (void) signal_number;
+    was_echo_on_in_handler = is_echo_on(signalled_terminal);
+}
+
+TEST raw_terminal_is_restored_on_signal() {
+    int master;
+    int slave;
+    ASSERT(open_test_terminal(&master, &slave));
+    struct sigaction action;
+    struct sigaction original_action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = check_terminal_mode;
+    sigaction(SIGTERM, &action, &original_action);
+    signalled_terminal = slave;
+    was_echo_on_in_handler = 0;
+
+    InputReader reader;
+    bool is_opened = open_input_reader(&reader, slave);
+    bool is_raw = reader.is_raw && !is_echo_on(slave);
+    raise(SIGTERM);
+    bool is_raw_again = !is_echo_on(slave);
+    close_input_reader(&reader);
+    bool is_restored = is_echo_on(slave);
+    struct sigaction current_action;
+    sigaction(SIGTERM, &original_action, &current_action);
+    close(slave);
+    close(master);
+
+    ASSERT(is_opened);
+    ASSERT(is_raw);
+    ASSERT(was_echo_on_in_handler);
+    ASSERT(is_raw_again);
+    ASSERT(is_restored);
+    ASSERT(current_action.sa_handler == check_terminal_mode);
+    PASS();
+}
+
+TEST input_board_parameters_restores_terminal() {
+    int master;
+    int slave;
+    ASSERT(open_test_terminal(&master, &slave));
+    ASSERT(write(master, "5\n6\n7\n", 6) == 6);
+    FILE *terminal = fdopen(slave, "r");
+    ASSERT(terminal != NULL);
+
+    FILE *original_stdin = stdin;
+    stdin = terminal;
+    int row_count = 0;
+    int column_count = 0;
+    int mine_count = 0;
+    bool is_read = input_board_parameters(&row_count, &column_count, &mine_count);
+    stdin = original_stdin;
+    bool is_restored = is_echo_on(slave);
+    fclose(terminal);
+    close(master);
+
+    ASSERT(is_read);
+    ASSERT_EQ(5, row_count);
+    ASSERT_EQ(6, column_count);
+    ASSERT_EQ(7, mine_count);
+    ASSERT(is_restored);
+    PASS();
+}
+
+TEST move_cursor_stops_at_edge() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    TilePosition cursor = {0, 0};
+    move_cursor(board, &cursor, KEY_UP);
+    move_cursor(board, &cursor, KEY_LEFT);
+    ASSERT_EQ(0, cursor.row);
+    ASSERT_EQ(0, cursor.column);
+    move_cursor(board, &cursor, KEY_DOWN);
+    move_cursor(board, &cursor, KEY_RIGHT);
+    ASSERT_EQ(1, cursor.row);
+    ASSERT_EQ(1, cursor.column);
+    destroy_board(board);
+    PASS();
+}
+
+TEST move_cursor_wraps_on_torus() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, TORUS));
+    TilePosition cursor = {0, 0};
+    move_cursor(board, &cursor, KEY_UP);
+    move_cursor(board, &cursor, KEY_LEFT);
+    ASSERT_EQ(2, cursor.row);
+    ASSERT_EQ(2, cursor.column);
+    destroy_board(board);
+    PASS();
+}
+
+SUITE(test_input) {
+    RUN_TEST(read_input_event_decodes_keys);
+    RUN_TEST(read_input_event_times_out_without_key);
+    RUN_TEST(read_number_consumes_malformed_input);
+    RUN_TEST(read_number_accepts_erased_mistake);
+    RUN_TEST(read_number_rejects_int_overflow);
+    RUN_TEST(read_number_survives_interrupted_wait);
+    RUN_TEST(raw_terminal_is_restored_on_signal);
+    RUN_TEST(input_board_parameters_restores_terminal);
+    RUN_TEST(move_cursor_stops_at_edge);
+    RUN_TEST(move_cursor_wraps_on_torus);
+}
@@ -0,0 +1,265 @@
+#include "greatest.h"
+#include "../board.h"
+#include "../spectator.h"
+
+typedef struct {
+    SpectatorView view;
+    SpectatorFrame *last_frame;
+    int received_count;
+    bool is_consistent;
+} TestViewer;
+
+static void receive_frame(SpectatorFrame *frame, void *context) {
+    TestViewer *viewer = (TestViewer *) context;
+    viewer->last_frame = frame;
+    viewer->received_count++;
+    if (!apply_spectator_frame(&viewer->view, frame)) {
+        viewer->is_consistent = false;
+    }
+}
+
+static void count_frame(SpectatorFrame *frame, void *context) {
+    (void) frame;
+    (*(int *) context)++;
+}
+
+typedef struct {
+    SpectatorFrame **frames;
+    int *frame_count;
+} FrameKeeper;
+
+static void keep_frame(SpectatorFrame *frame, void *context) {
+    FrameKeeper *keeper = (FrameKeeper *) context;
+    retain_frame(frame);
+    keeper->frames[*keeper->frame_count] = frame;
+    (*keeper->frame_count)++;
+}
+
+static bool is_view_equal_to_board(SpectatorView *view, Board *board) {
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            if (view->states[row * board->column_count + column] != get_visible_tile_state(board->tiles[row][column])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static Board *create_played_board() {
+    Board *board = create_board(9, 9, 10);
+    if (board != NULL) {
+        set_mines_with_seed(board, 7, 4, 4);
+        set_tile_values(board);
+    }
+    return board;
+}
+
+TEST spectator_view_follows_board() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 4);
+    ASSERT(channel != NULL);
+    TestViewer viewer = {.is_consistent = true};
+    ASSERT(subscribe_spectator(channel, receive_frame, &viewer) >= 0);
+
+    ASSERT(publish_move(channel));
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            if (board->tiles[row][column]->is_mine) {
+                set_tile_state(board, row, column, MARKED);
+            } else {
+                open_tile(board, row, column);
+            }
+            publish_move(channel);
+            ASSERT(viewer.is_consistent);
+            ASSERT(is_view_equal_to_board(&viewer.view, board));
+        }
+    }
+
+    SpectatorStats stats = get_spectator_stats(channel);
+    ASSERT_EQ(stats.frame_count, (unsigned long long) viewer.received_count);
+    ASSERT(stats.keyframe_count < stats.frame_count);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST publish_move_without_change_sends_nothing() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 4);
+    ASSERT(channel != NULL);
+    int received_count = 0;
+    ASSERT(subscribe_spectator(channel, count_frame, &received_count) >= 0);
+
+    ASSERT(publish_move(channel));
+    ASSERT_FALSE(publish_move(channel));
+    set_tile_state(board, 0, 0, MARKED);
+    set_tile_state(board, 0, 0, CLOSED);
+    ASSERT_FALSE(publish_move(channel));
+    ASSERT_EQ(1, received_count);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST publish_move_sends_direct_tile_writes() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 4);
+    ASSERT(channel != NULL);
+    TestViewer viewer = {.is_consistent = true};
+    ASSERT(subscribe_spectator(channel, receive_frame, &viewer) >= 0);
+
+    ASSERT(publish_move(channel));
+    board->tiles[0][0]->tile_state = MARKED;
+    ASSERT(publish_move(channel));
+    ASSERT(viewer.is_consistent);
+    ASSERT(is_view_equal_to_board(&viewer.view, board));
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST publish_move_sends_keyframe_after_topology_change() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 100);
+    ASSERT(channel != NULL);
+    TestViewer viewer = {.is_consistent = true};
+    ASSERT(subscribe_spectator(channel, receive_frame, &viewer) >= 0);
+
+    ASSERT(publish_move(channel));
+    ASSERT_EQ(RECTANGLE, viewer.view.topology);
+    ASSERT(set_board_topology(board, TORUS));
+    ASSERT(publish_move(channel));
+    ASSERT_EQ(TORUS, viewer.view.topology);
+    ASSERT_EQ(2ULL, get_spectator_stats(channel).keyframe_count);
+    ASSERT_FALSE(publish_move(channel));
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST subscribers_share_one_frame() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 4);
+    ASSERT(channel != NULL);
+    TestViewer first = {.is_consistent = true};
+    TestViewer second = {.is_consistent = true};
+    ASSERT(subscribe_spectator(channel, receive_frame, &first) >= 0);
+    ASSERT(subscribe_spectator(channel, receive_frame, &second) >= 0);
+
+    ASSERT(publish_move(channel));
+    ASSERT(first.last_frame == second.last_frame);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST late_subscriber_gets_keyframe() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 100);
+    ASSERT(channel != NULL);
+    int received_count = 0;
+    ASSERT(subscribe_spectator(channel, count_frame, &received_count) >= 0);
+    ASSERT(publish_move(channel));
+    set_tile_state(board, 0, 0, MARKED);
+    ASSERT(publish_move(channel));
+
+    TestViewer viewer = {.is_consistent = true};
+    ASSERT(subscribe_spectator(channel, receive_frame, &viewer) >= 0);
+    ASSERT_EQ(1, viewer.received_count);
+    set_tile_state(board, 0, 1, MARKED);
+    ASSERT(publish_move(channel));
+    ASSERT(viewer.is_consistent);
+    ASSERT(is_view_equal_to_board(&viewer.view, board));
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST apply_spectator_frame_rejects_gap() {
+    Board *board = create_played_board();
+    ASSERT(board != NULL);
+    SpectatorChannel *channel = create_spectator_channel(board, 100);
+    ASSERT(channel != NULL);
+    SpectatorFrame *frames[2] = {NULL, NULL};
+    int frame_count = 0;
+    FrameKeeper keeper = {frames, &frame_count};
+    ASSERT(subscribe_spectator(channel, keep_frame, &keeper) >= 0);
+    ASSERT(publish_move(channel));
+    set_tile_state(board, 0, 0, MARKED);
+    ASSERT(publish_move(channel));
+    ASSERT_EQ(2, frame_count);
+
+    SpectatorView view = {0};
+    ASSERT_FALSE(apply_spectator_frame(&view, frames[1]));
+    ASSERT(apply_spectator_frame(&view, frames[0]));
+    ASSERT(apply_spectator_frame(&view, frames[1]));
+    ASSERT(is_view_equal_to_board(&view, board));
+    ASSERT_FALSE(apply_spectator_frame(&view, frames[1]));
+    ASSERT_FALSE(view.is_synchronized);
+    ASSERT(apply_spectator_frame(&view, frames[0]));
+    ASSERT(view.is_synchronized);
+
+    release_frame(frames[0]);
+    release_frame(frames[1]);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+TEST spectator_fan_out_to_many_viewers() {
+    Board *board = create_board(30, 30, 150);
+    ASSERT(board != NULL);
+    set_mines_with_seed(board, 11, 0, 0);
+    set_tile_values(board);
+    SpectatorChannel *channel = create_spectator_channel(board, 32);
+    ASSERT(channel != NULL);
+
+    int viewer_count = 1000;
+    int received_count = 0;
+    for (int viewer = 0; viewer < viewer_count; viewer++) {
+        ASSERT(subscribe_spectator(channel, count_frame, &received_count) >= 0);
+    }
+
+    ASSERT(publish_move(channel));
+    int move_count = 0;
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            if (!board->tiles[row][column]->is_mine && open_tile(board, row, column) > 0) {
+                ASSERT(publish_move(channel));
+                move_count++;
+            }
+        }
+    }
+
+    SpectatorStats stats = get_spectator_stats(channel);
+    ASSERT_EQ(stats.frame_count * viewer_count, stats.delivered_frames);
+    ASSERT_EQ(stats.delivered_frames, (unsigned long long) received_count);
+
+    ASSERT_EQ((unsigned long long) move_count + 1, stats.frame_count);
+
+    // deltas are smaller than keyframes, timing is measured by bench_spectator
+    unsigned long long keyframe_size = KEYFRAME_HEADER_SIZE + (30 * 30 + 1) / 2;
+    ASSERT(stats.keyframe_count < stats.frame_count);
+    ASSERT(stats.encoded_bytes < stats.frame_count * keyframe_size);
+    destroy_spectator_channel(channel);
+    destroy_board(board);
+    PASS();
+}
+
+SUITE(test_spectator) {
+    RUN_TEST(spectator_view_follows_board);
+    RUN_TEST(publish_move_without_change_sends_nothing);
+    RUN_TEST(publish_move_sends_direct_tile_writes);
+    RUN_TEST(publish_move_sends_keyframe_after_topology_change);
+    RUN_TEST(subscribers_share_one_frame);
+    RUN_TEST(late_subscriber_gets_keyframe);
+    RUN_TEST(apply_spectator_frame_rejects_gap);
+    RUN_TEST(spectator_fan_out_to_many_viewers);
+}
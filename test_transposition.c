@@ -0,0 +1,91 @@
+#include "greatest.h"
+#include "../board.h"
+#include "../transposition.h"
+
+static bool count_open_tiles(Board *board, void *context, void *result) {
+    int *call_count = (int *) context;
+    (*call_count)++;
+    int open_count = 0;
+    for (int row = 0; row < board->row_count; row++) {
+        for (int column = 0; column < board->column_count; column++) {
+            if (board->tiles[row][column]->tile_state == OPEN) {
+                open_count++;
+            }
+        }
+    }
+    *(int *) result = open_count;
+    return true;
+}
+
+TEST cache_lookup_finds_stored_result() {
+    TranspositionCache *cache = create_transposition_cache(16, sizeof(int));
+    ASSERT(cache != NULL);
+    int stored = 7;
+    int found = 0;
+    ASSERT_FALSE(cache_lookup(cache, 123, &found));
+    cache_store(cache, 123, &stored);
+    ASSERT(cache_lookup(cache, 123, &found));
+    ASSERT_EQ(7, found);
+
+    CacheStats stats = get_cache_stats(cache);
+    ASSERT_EQ(1, stats.hits);
+    ASSERT_EQ(1, stats.misses);
+    ASSERT_EQ(1, stats.stores);
+    destroy_transposition_cache(cache);
+    PASS();
+}
+
+TEST cache_store_replaces_position_in_same_slot() {
+    TranspositionCache *cache = create_transposition_cache(4, sizeof(int));
+    ASSERT(cache != NULL);
+    int first = 1;
+    int second = 2;
+    int found = 0;
+    cache_store(cache, 1, &first);
+    cache_store(cache, 5, &second);
+    ASSERT_FALSE(cache_lookup(cache, 1, &found));
+    ASSERT(cache_lookup(cache, 5, &found));
+    ASSERT_EQ(2, found);
+    ASSERT_EQ(1, get_cache_stats(cache).evictions);
+    destroy_transposition_cache(cache);
+    PASS();
+}
+
+TEST cache_analyze_skips_analysis_on_hit() {
+    TranspositionCache *cache = create_transposition_cache(64, sizeof(int));
+    Board *board = create_board(3, 3, 1);
+    ASSERT(cache != NULL && board != NULL);
+    place_mine(board, 0, 0);
+    set_tile_values(board);
+    set_tile_state(board, 2, 2, OPEN);
+
+    int call_count = 0;
+    int result = 0;
+    ASSERT(cache_analyze(cache, board, count_open_tiles, &call_count, &result));
+    ASSERT(cache_analyze(cache, board, count_open_tiles, &call_count, &result));
+    ASSERT_EQ(1, call_count);
+    ASSERT_EQ(1, result);
+
+    set_tile_state(board, 2, 1, OPEN);
+    ASSERT(cache_analyze(cache, board, count_open_tiles, &call_count, &result));
+    ASSERT_EQ(2, call_count);
+    ASSERT_EQ(2, result);
+    ASSERT(get_cache_hit_rate(cache) > 0.3 && get_cache_hit_rate(cache) < 0.4);
+
+    destroy_board(board);
+    destroy_transposition_cache(cache);
+    PASS();
+}
+
+TEST create_transposition_cache_invalid_parameters() {
+    ASSERT(create_transposition_cache(0, sizeof(int)) == NULL);
+    ASSERT(create_transposition_cache(16, 0) == NULL);
+    PASS();
+}
+
+SUITE(test_transposition) {
+    RUN_TEST(cache_lookup_finds_stored_result);
+    RUN_TEST(cache_store_replaces_position_in_same_slot);
+    RUN_TEST(cache_analyze_skips_analysis_on_hit);
+    RUN_TEST(create_transposition_cache_invalid_parameters);
+}
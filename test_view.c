@@ -1,6 +1,7 @@
 #include "greatest.h"
 #include "../board.h"
 #include "../view.h"
+#include "../termcolor.h"
 
 TEST view_play_field_empty_board() {
     Board *board = create_board(3, 3, 1);
@@ -38,7 +39,7 @@ TEST view_play_field_with_marked_tile() {
 TEST view_play_field_with_mine() {
     Board *board = create_board(3, 3, 1);
     ASSERT(board != NULL);
-    board->tiles[1][1]->is_mine = true;
+    place_mine(board, 1, 1);
     board->tiles[1][1]->tile_state = OPEN;
     char *result = view_play_field(board, 1, 1);
 
@@ -48,6 +49,47 @@ TEST view_play_field_with_mine() {
     PASS();
 }
 
+TEST view_play_field_shifts_odd_hexagon_rows() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    ASSERT(set_board_topology(board, HEXAGON));
+    place_mine(board, 1, 2);
+    char *result = view_play_field(board, 1, 1);
+    ASSERT_STR_EQ("   1 2 3 \n1  - - - \n2   - - - \n3  - - - \n", result);
+    free(result);
+    result = view_mine_tiles(board, 1);
+    ASSERT_STR_EQ("\033[3;9H-", result);
+    free(result);
+    destroy_board(board);
+    PASS();
+}
+
+TEST view_mine_tiles_redraws_only_mines() {
+    Board *board = create_board(3, 3, 2);
+    ASSERT(board != NULL);
+    place_mine(board, 0, 0);
+    place_mine(board, 2, 1);
+    board->tiles[2][1]->tile_state = OPEN;
+    char *result = view_mine_tiles(board, 1);
+    ASSERT_STR_EQ("\033[2;4H-\033[4;6HX", result);
+    free(result);
+    destroy_board(board);
+    PASS();
+}
+
+TEST view_cursor_move_redraws_two_tiles() {
+    Board *board = create_board(3, 3, 1);
+    ASSERT(board != NULL);
+    board->tiles[0][0]->tile_state = MARKED;
+    TilePosition from = {0, 0};
+    TilePosition to = {0, 1};
+    char *result = view_cursor_move(board, from, to, 1);
+    ASSERT_STR_EQ("\033[2;4H!\033[2;6H\033[7m-" COLOR_DEFAULT "\033[2;6H", result);
+    free(result);
+    destroy_board(board);
+    PASS();
+}
+
 TEST view_play_field_invalid_board() {
     Board *board = create_board(31, 5, 5);
     char *result = view_play_field(board, 1, 1);
@@ -68,6 +110,9 @@ SUITE(test_view) {
     RUN_TEST(view_play_field_with_open_tile);
     RUN_TEST(view_play_field_with_marked_tile);
     RUN_TEST(view_play_field_with_mine);
+    RUN_TEST(view_mine_tiles_redraws_only_mines);
+    RUN_TEST(view_play_field_shifts_odd_hexagon_rows);
+    RUN_TEST(view_cursor_move_redraws_two_tiles);
     RUN_TEST(view_play_field_invalid_board);
     RUN_TEST(view_play_field_null_board);
 }
@@ -0,0 +1,146 @@
+#ifndef MINES_TOPOLOGY_H
+#define MINES_TOPOLOGY_H
+#include "board.h"
+
+#define MAX_NEIGHBOUR_COUNT 8
+
+/*
+ * Neighbour functions write coordinates of the tiles adjacent to [row][column]
+ * into neighbours and return their count. They are inline, so loops written
+ * for one topology are compiled with its offsets and boundary handling built in.
+ */
+
+/**
+ * Move coordinate back into range 0 to count - 1 over the edge of the Board.
+ * @return wrapped coordinate
+ */
+static inline int wrap_coordinate(int coordinate, int count) {
+    coordinate %= count;
+    return coordinate < 0 ? coordinate + count : coordinate;
+}
+
+/**
+ * Up to 8 neighbours, tiles beyond the edge are left out.
+ */
+static inline int rectangle_neighbours(const Board *board, int row, int column, TilePosition *neighbours) {
+    // clip the 3x3 square once instead of checking every neighbour
+    int first_row = row > 0 ? row - 1 : 0;
+    int last_row = row < board->row_count - 1 ? row + 1 : board->row_count - 1;
+    int first_column = column > 0 ? column - 1 : 0;
+    int last_column = column < board->column_count - 1 ? column + 1 : board->column_count - 1;
+
+    int count = 0;
+    for (int neighbour_row = first_row; neighbour_row <= last_row; neighbour_row++) {
+        for (int neighbour_column = first_column; neighbour_column <= last_column; neighbour_column++) {
+            if (neighbour_row != row || neighbour_column != column) {
+                neighbours[count].row = neighbour_row;
+                neighbours[count].column = neighbour_column;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Always 8 neighbours, tiles beyond the edge continue on the opposite edge.
+ * Board must have at least 3 rows and 3 columns, so no tile is listed twice.
+ */
+static inline int torus_neighbours(const Board *board, int row, int column, TilePosition *neighbours) {
+    int count = 0;
+    for (int drow = -1; drow <= 1; drow++) {
+        for (int dcolumn = -1; dcolumn <= 1; dcolumn++) {
+            if (drow != 0 || dcolumn != 0) {
+                neighbours[count].row = wrap_coordinate(row + drow, board->row_count);
+                neighbours[count].column = wrap_coordinate(column + dcolumn, board->column_count);
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Up to 6 neighbours of hexagonal tiles, odd rows are shifted half a tile to the right.
+ * Tiles beyond the edge are left out.
+ */
+static inline int hexagon_neighbours(const Board *board, int row, int column, TilePosition *neighbours) {
+    static const int offsets[2][6][2] = {
+            {{-1, -1}, {-1, 0}, {0, -1}, {0, 1}, {1, -1}, {1, 0}},
+            {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, 0}, {1, 1}}
+    };
+    int count = 0;
+    for (int index = 0; index < 6; index++) {
+        int neighbour_row = row + offsets[row & 1][index][0];
+        int neighbour_column = column + offsets[row & 1][index][1];
+        if (neighbour_row >= 0 && neighbour_row < board->row_count
+            && neighbour_column >= 0 && neighbour_column < board->column_count) {
+            neighbours[count].row = neighbour_row;
+            neighbours[count].column = neighbour_column;
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Count mines on the listed tiles.
+ * @return count of mines
+ */
+static inline int count_mines_on(const Board *board, const TilePosition *positions, int position_count) {
+    int count = 0;
+    for (int index = 0; index < position_count; index++) {
+        if (board->tiles[positions[index].row][positions[index].column]->is_mine) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/*
+ * Neighbour mine counters, one per topology. The rectangle one walks the clipped
+ * square directly, because it is the hot path and building the list costs more than the count.
+ */
+
+static inline int rectangle_neighbour_mines(const Board *board, int row, int column) {
+    int first_row = row > 0 ? row - 1 : 0;
+    int last_row = row < board->row_count - 1 ? row + 1 : board->row_count - 1;
+    int first_column = column > 0 ? column - 1 : 0;
+    int last_column = column < board->column_count - 1 ? column + 1 : board->column_count - 1;
+
+    int count = 0;
+    for (int neighbour_row = first_row; neighbour_row <= last_row; neighbour_row++) {
+        for (int neighbour_column = first_column; neighbour_column <= last_column; neighbour_column++) {
+            count += board->tiles[neighbour_row][neighbour_column]->is_mine;
+        }
+    }
+    // the square includes the Tile itself
+    return count - board->tiles[row][column]->is_mine;
+}
+
+static inline int torus_neighbour_mines(const Board *board, int row, int column) {
+    TilePosition neighbours[MAX_NEIGHBOUR_COUNT];
+    return count_mines_on(board, neighbours, torus_neighbours(board, row, column, neighbours));
+}
+
+static inline int hexagon_neighbour_mines(const Board *board, int row, int column) {
+    TilePosition neighbours[MAX_NEIGHBOUR_COUNT];
+    return count_mines_on(board, neighbours, hexagon_neighbours(board, row, column, neighbours));
+}
+
+/**
+ * Neighbours according to topology of the Board.
+ * Loops over the whole Board should switch on the topology once and call the functions above instead.
+ */
+static inline int get_neighbours(const Board *board, int row, int column, TilePosition *neighbours) {
+    switch (board->topology) {
+        case TORUS:
+            return torus_neighbours(board, row, column, neighbours);
+        case HEXAGON:
+            return hexagon_neighbours(board, row, column, neighbours);
+        default:
+            return rectangle_neighbours(board, row, column, neighbours);
+    }
+}
+
+#endif //MINES_TOPOLOGY_H
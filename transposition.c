@@ -0,0 +1,159 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "transposition.h"
+
+#define CACHE_LOCK_COUNT 64
+
+typedef struct {
+    uint64_t hash;               /* Hash of the stored position */
+    bool is_used;                /* Records if the slot holds a result */
+} CacheSlot;
+
+struct TranspositionCache {
+    int capacity;                                   /* Number of slots, each holds one position */
+    size_t result_size;                             /* Size of one stored result in bytes */
+    CacheSlot *slots;                               /* Slot of a position is chosen by its hash */
+    unsigned char *results;                         /* Result of slot i starts at i * result_size */
+    pthread_mutex_t locks[CACHE_LOCK_COUNT];        /* Slot i is guarded by lock i % CACHE_LOCK_COUNT */
+    atomic_ullong hits;
+    atomic_ullong misses;
+    atomic_ullong stores;
+    atomic_ullong evictions;
+};
+
+/**
+ * Create cache for at most capacity positions, each with result of result_size bytes.
+ * @return pointer of the cache, or NULL if parameters are invalid or memory allocation fails
+ */
+TranspositionCache *create_transposition_cache(int capacity, size_t result_size) {
+    if (capacity <= 0 || result_size == 0) {
+        return NULL;
+    }
+
+    TranspositionCache *cache = (TranspositionCache *) calloc(1, sizeof(TranspositionCache));
+    if (cache == NULL) return NULL;
+
+    cache->capacity = capacity;
+    cache->result_size = result_size;
+    cache->slots = (CacheSlot *) calloc(capacity, sizeof(CacheSlot));
+    cache->results = (unsigned char *) calloc(capacity, result_size);
+    if (cache->slots == NULL || cache->results == NULL) {
+        free(cache->slots);
+        free(cache->results);
+        free(cache);
+        return NULL;
+    }
+    for (int lock = 0; lock < CACHE_LOCK_COUNT; lock++) {
+        pthread_mutex_init(&cache->locks[lock], NULL);
+    }
+    atomic_init(&cache->hits, 0);
+    atomic_init(&cache->misses, 0);
+    atomic_init(&cache->stores, 0);
+    atomic_init(&cache->evictions, 0);
+    return cache;
+}
+
+/**
+ * Free the cache and all stored results.
+ */
+void destroy_transposition_cache(TranspositionCache *cache) {
+    assert(cache != NULL);
+
+    for (int lock = 0; lock < CACHE_LOCK_COUNT; lock++) {
+        pthread_mutex_destroy(&cache->locks[lock]);
+    }
+    free(cache->slots);
+    free(cache->results);
+    free(cache);
+}
+
+/**
+ * Copy stored result of the position into result.
+ * @return true if the position was found, false otherwise
+ */
+bool cache_lookup(TranspositionCache *cache, uint64_t hash, void *result) {
+    assert(cache != NULL);
+    assert(result != NULL);
+
+    int slot = (int) (hash % (uint64_t) cache->capacity);
+    pthread_mutex_t *lock = &cache->locks[slot % CACHE_LOCK_COUNT];
+
+    pthread_mutex_lock(lock);
+    bool is_found = cache->slots[slot].is_used && cache->slots[slot].hash == hash;
+    if (is_found) {
+        memcpy(result, cache->results + (size_t) slot * cache->result_size, cache->result_size);
+    }
+    pthread_mutex_unlock(lock);
+
+    atomic_fetch_add_explicit(is_found ? &cache->hits : &cache->misses, 1, memory_order_relaxed);
+    return is_found;
+}
+
+/**
+ * Store result of the position. A different position in the same slot is replaced.
+ */
+void cache_store(TranspositionCache *cache, uint64_t hash, const void *result) {
+    assert(cache != NULL);
+    assert(result != NULL);
+
+    int slot = (int) (hash % (uint64_t) cache->capacity);
+    pthread_mutex_t *lock = &cache->locks[slot % CACHE_LOCK_COUNT];
+
+    pthread_mutex_lock(lock);
+    bool is_eviction = cache->slots[slot].is_used && cache->slots[slot].hash != hash;
+    cache->slots[slot].hash = hash;
+    cache->slots[slot].is_used = true;
+    memcpy(cache->results + (size_t) slot * cache->result_size, result, cache->result_size);
+    pthread_mutex_unlock(lock);
+
+    atomic_fetch_add_explicit(&cache->stores, 1, memory_order_relaxed);
+    if (is_eviction) {
+        atomic_fetch_add_explicit(&cache->evictions, 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * Get result of the analysis for the visible state of the Board.
+ * On a cache hit the analysis is not called at all, otherwise its result is stored for next time.
+ * @return true if result is filled, false if the analysis had no result
+ */
+bool cache_analyze(TranspositionCache *cache, Board *board, BoardAnalysis analysis, void *context, void *result) {
+    assert(cache != NULL);
+    assert(board != NULL);
+    assert(analysis != NULL);
+
+    if (cache_lookup(cache, board->hash, result)) {
+        return true;
+    }
+    if (!analysis(board, context, result)) {
+        return false;
+    }
+    cache_store(cache, board->hash, result);
+    return true;
+}
+
+/**
+ * @return snapshot of the cache counters
+ */
+CacheStats get_cache_stats(TranspositionCache *cache) {
+    assert(cache != NULL);
+
+    CacheStats stats;
+    stats.hits = atomic_load_explicit(&cache->hits, memory_order_relaxed);
+    stats.misses = atomic_load_explicit(&cache->misses, memory_order_relaxed);
+    stats.stores = atomic_load_explicit(&cache->stores, memory_order_relaxed);
+    stats.evictions = atomic_load_explicit(&cache->evictions, memory_order_relaxed);
+    return stats;
+}
+
+/**
+ * @return share of lookups which found the position, 0 if there was no lookup yet
+ */
+double get_cache_hit_rate(TranspositionCache *cache) {
+    CacheStats stats = get_cache_stats(cache);
+    unsigned long long lookups = stats.hits + stats.misses;
+    return lookups == 0 ? 0.0 : (double) stats.hits / (double) lookups;
+}
@@ -0,0 +1,27 @@
+#ifndef MINES_TRANSPOSITION_H
+#define MINES_TRANSPOSITION_H
+#include <stddef.h>
+#include <stdint.h>
+#include "board.h"
+
+typedef struct TranspositionCache TranspositionCache;
+
+typedef struct {
+    unsigned long long hits;       /* Lookups which found the position */
+    unsigned long long misses;     /* Lookups which did not find the position */
+    unsigned long long stores;     /* Results written to the cache */
+    unsigned long long evictions;  /* Stored results which replaced another position */
+} CacheStats;
+
+/* Computes result of the analysis of the Board into result, returns false if there is no result */
+typedef bool (*BoardAnalysis)(Board *board, void *context, void *result);
+
+TranspositionCache *create_transposition_cache(int capacity, size_t result_size);
+void destroy_transposition_cache(TranspositionCache *cache);
+bool cache_lookup(TranspositionCache *cache, uint64_t hash, void *result);
+void cache_store(TranspositionCache *cache, uint64_t hash, const void *result);
+bool cache_analyze(TranspositionCache *cache, Board *board, BoardAnalysis analysis, void *context, void *result);
+CacheStats get_cache_stats(TranspositionCache *cache);
+double get_cache_hit_rate(TranspositionCache *cache);
+
+#endif //MINES_TRANSPOSITION_H
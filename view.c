@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <stdio.h>
 #include <string.h>
 #include "view.h"
 #include "termcolor.h"
@@ -12,6 +13,8 @@ Color value_colors[] = {
 void view_column_coordinates(StringBuilder *sb, int column_count);
 void view_tile(StringBuilder *sb, Tile *tile, bool is_mine_on_selected_tile);
 void view_value(StringBuilder *sb, int value);
+bool is_row_shifted(Board *board, int row);
+void view_tile_at(StringBuilder *sb, Board *board, TilePosition position, int field_top);
 
 /** Return top score from list of players.
  * @param players array of players and their score
@@ -42,6 +45,9 @@ char *view_play_field(Board *board, int input_row, int input_column) {
     int row_enumeration = 1;
     for (int row = 0; row < board->row_count; row++) {
         sb_appendf(sb, "%d  ", row_enumeration);
+        if (is_row_shifted(board, row)) {
+            sb_append(sb, " ");
+        }
 
         for (int column = 0; column < board->column_count; column++) {
             if (row == input_row - 1 && column == input_column - 1) {
@@ -57,6 +63,50 @@ char *view_play_field(Board *board, int input_row, int input_column) {
     return sb_concat_free(sb);
 }
 
+/**
+ * Return redraw of the mined tiles only.
+ * Each tile is prefixed with a cursor move, so the string can be printed over
+ * a play field whose column coordinates line starts at terminal row field_top.
+ */
+char *view_mine_tiles(Board *board, int field_top) {
+    assert(board != NULL);
+    assert(is_mine_index_correct(board));
+    StringBuilder *sb = sb_create();
+    for (int index = 0; index < board->placed_mine_count; index++) {
+        view_tile_at(sb, board, board->mines[index], field_top);
+        view_tile(sb, board->tiles[board->mines[index].row][board->mines[index].column], false);
+    }
+    return sb_concat_free(sb);
+}
+
+/**
+ * Return redraw of the two tiles touched by a cursor move, the rest of the play field stays on screen.
+ * The tile under the cursor is shown in reverse video, terminal cursor is left on it.
+ */
+char *view_cursor_move(Board *board, TilePosition from, TilePosition to, int field_top) {
+    assert(board != NULL);
+    StringBuilder *sb = sb_create();
+    view_tile_at(sb, board, from, field_top);
+    view_tile(sb, board->tiles[from.row][from.column], false);
+    view_tile_at(sb, board, to, field_top);
+    sb_append(sb, "\033[7m");
+    view_tile(sb, board->tiles[to.row][to.column], false);
+    sb_append(sb, COLOR_DEFAULT);
+    view_tile_at(sb, board, to, field_top);
+    return sb_concat_free(sb);
+}
+
+/**
+ * Move terminal cursor onto the Tile of a play field printed from terminal row field_top.
+ */
+void view_tile_at(StringBuilder *sb, Board *board, TilePosition position, int field_top) {
+    char row_label[16];
+    // same layout as view_play_field: row label, then one tile and one space per column
+    int label_width = snprintf(row_label, sizeof(row_label), "%d  ", position.row + 1);
+    int shift = is_row_shifted(board, position.row) ? 1 : 0;
+    sb_appendf(sb, "\033[%d;%dH", field_top + 1 + position.row, label_width + shift + 2 * position.column + 1);
+}
+
 /**
  * Enumerate columns beyond play field
  */
@@ -68,6 +118,14 @@ void view_column_coordinates(StringBuilder *sb, int column_count) {
     sb_append(sb, "\n");
 }
 
+/**
+ * Odd rows of HEXAGON board are drawn half a tile to the right,
+ * so every Tile sits between its neighbours from the rows above and below.
+ */
+bool is_row_shifted(Board *board, int row) {
+    return board->topology == HEXAGON && row % 2 == 1;
+}
+
 /**
  * Generate one single Tile
  */